@@ -0,0 +1,323 @@
+#pragma once
+// Host stand-in of the Arduino ESP32 core, used by the native env (unit tests) and the native_ui env (UI host build).
+// Only what the firmware and its headers use is here, with the same names and signatures. The timing and log part
+// is plain C because LVGL include this header from lv_tick.c (LV_TICK_CUSTOM_INCLUDE)
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include <stdlib.h>
+#include <ctype.h>
+#include <math.h>
+#include <time.h>
+#include <sched.h>
+
+#ifndef ARDUINO
+#define ARDUINO 10819 // Same as the ESP32 core, libraries pick their Arduino 1.x code path
+#endif
+
+#define HIGH 1
+#define LOW 0
+#define INPUT 0x01
+#define OUTPUT 0x03
+#define INPUT_PULLUP 0x05
+#define RISING 0x01
+#define FALLING 0x02
+#define CHANGE 0x03
+#define IRAM_ATTR
+#define ARDUINO_ISR_ATTR
+#define PROGMEM
+#define pgm_read_byte(addr) (*(const uint8_t*)(addr))
+#define pgm_read_word(addr) (*(const uint16_t*)(addr))
+#define pgm_read_dword(addr) (*(const uint32_t*)(addr))
+#define pgm_read_ptr(addr) (*(void* const*)(addr))
+#define memcpy_P memcpy
+#define memcmp_P memcmp
+#define strlen_P strlen
+#define F(str) ((const __FlashStringHelper*)(str))
+#define bitRead(value, bit) (((value) >> (bit)) & 0x01)
+#define bitSet(value, bit) ((value) |= (1UL << (bit)))
+#define bitClear(value, bit) ((value) &= ~(1UL << (bit)))
+#define bitWrite(value, bit, bitvalue) ((bitvalue) ? bitSet(value, bit) : bitClear(value, bit))
+
+typedef bool boolean;
+typedef uint8_t byte;
+
+// Monotonic clock shared by every translation unit, C ones included, so LVGL ticks and millis() agree. Counted from
+// the first read like the ESP32 count from boot, the weak definition give all of them the same origin
+__attribute__((weak)) uint64_t host_boot_us;
+static inline uint64_t host_micros64(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    uint64_t now = (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+    if (!host_boot_us)
+        host_boot_us = now - 1;
+    return now - host_boot_us;
+}
+// 32 bit like on the ESP32, so "millis() - start" with a uint32_t start wrap the same way
+static inline uint32_t millis(void) { return (uint32_t)(host_micros64() / 1000); }
+static inline uint32_t micros(void) { return (uint32_t)host_micros64(); }
+static inline void delayMicroseconds(uint32_t us)
+{
+    struct timespec ts = { (time_t)(us / 1000000), (long)(us % 1000000) * 1000 };
+    while (nanosleep(&ts, &ts) != 0)
+        ;
+}
+static inline void delay(uint32_t ms)
+{
+    if (ms)
+        delayMicroseconds(ms * 1000);
+    else
+        sched_yield();
+}
+static inline void yield(void) { sched_yield(); }
+
+static inline void pinMode(uint8_t pin, uint8_t mode) {}
+static inline void digitalWrite(uint8_t pin, uint8_t val) {}
+static inline int digitalRead(uint8_t pin) { return HIGH; }
+static inline int digitalPinToInterrupt(int pin) { return pin; }
+static inline void attachInterrupt(uint8_t pin, void (*handler)(void), int mode) {}
+static inline void detachInterrupt(uint8_t pin) {}
+
+// printf of the firmware, with the formats of the ESP32 where long is 32 bit. "%lu" is printed as "%u", which read the
+// low half of the 64 bit argument slot, right for both a uint32_t and a host long
+static inline int host_vsnprintf(char* buf, size_t size, const char* format, va_list args)
+{
+    char fmt[256];
+    size_t len = 0;
+    for (const char* p = format; *p && len < sizeof(fmt) - 2; p++) {
+        fmt[len++] = *p;
+        if (*p != '%')
+            continue;
+        if (p[1] == '%') {
+            fmt[len++] = *++p;
+            continue;
+        }
+        while (p[1] && strchr("-+ #0123456789.*", p[1]) && len < sizeof(fmt) - 2)
+            fmt[len++] = *++p;
+        if (p[1] == 'l' && p[2] && strchr("diuxXo", p[2]))
+            p++;
+    }
+    fmt[len] = '\0';
+    return vsnprintf(buf, size, fmt, args);
+}
+static inline void host_log(const char* level, const char* file, int line, const char* function, const char* format, ...)
+{
+    char text[512];
+    va_list args;
+    va_start(args, format);
+    host_vsnprintf(text, sizeof(text), format, args);
+    va_end(args);
+    fprintf(stderr, "[%6u][%s][%s:%u] %s(): %s\n", millis(), level, file, line, function, text);
+}
+
+#define ARDUHAL_LOG_LEVEL_NONE 0
+#define ARDUHAL_LOG_LEVEL_ERROR 1
+#define ARDUHAL_LOG_LEVEL_WARN 2
+#define ARDUHAL_LOG_LEVEL_INFO 3
+#define ARDUHAL_LOG_LEVEL_DEBUG 4
+#define ARDUHAL_LOG_LEVEL_VERBOSE 5
+#ifndef ARDUHAL_LOG_LEVEL
+#ifdef CORE_DEBUG_LEVEL
+#define ARDUHAL_LOG_LEVEL CORE_DEBUG_LEVEL
+#else
+#define ARDUHAL_LOG_LEVEL ARDUHAL_LOG_LEVEL_ERROR
+#endif
+#endif
+#define HOST_LOG(level, format, ...) host_log(level, __FILE__, __LINE__, __FUNCTION__, format, ##__VA_ARGS__)
+#define log_e(format, ...) HOST_LOG("E", format, ##__VA_ARGS__)
+#if ARDUHAL_LOG_LEVEL >= ARDUHAL_LOG_LEVEL_WARN
+#define log_w(format, ...) HOST_LOG("W", format, ##__VA_ARGS__)
+#else
+#define log_w(format, ...) do {} while (0)
+#endif
+#if ARDUHAL_LOG_LEVEL >= ARDUHAL_LOG_LEVEL_INFO
+#define log_i(format, ...) HOST_LOG("I", format, ##__VA_ARGS__)
+#else
+#define log_i(format, ...) do {} while (0)
+#endif
+#if ARDUHAL_LOG_LEVEL >= ARDUHAL_LOG_LEVEL_DEBUG
+#define log_d(format, ...) HOST_LOG("D", format, ##__VA_ARGS__)
+#else
+#define log_d(format, ...) do {} while (0)
+#endif
+#if ARDUHAL_LOG_LEVEL >= ARDUHAL_LOG_LEVEL_VERBOSE
+#define log_v(format, ...) HOST_LOG("V", format, ##__VA_ARGS__)
+#else
+#define log_v(format, ...) do {} while (0)
+#endif
+
+#ifdef __cplusplus
+#include <string>
+#include <mutex>
+#include <freertos/FreeRTOS.h>
+#include <esp_heap_caps.h>
+
+class __FlashStringHelper;
+
+typedef enum {
+    GPIO_NUM_NC = -1,
+    GPIO_NUM_0 = 0, GPIO_NUM_2 = 2, GPIO_NUM_4 = 4, GPIO_NUM_5 = 5, GPIO_NUM_12 = 12, GPIO_NUM_13 = 13,
+    GPIO_NUM_14 = 14, GPIO_NUM_15 = 15, GPIO_NUM_16 = 16, GPIO_NUM_17 = 17, GPIO_NUM_18 = 18, GPIO_NUM_19 = 19,
+    GPIO_NUM_21 = 21, GPIO_NUM_22 = 22, GPIO_NUM_23 = 23, GPIO_NUM_25 = 25, GPIO_NUM_26 = 26, GPIO_NUM_27 = 27,
+    GPIO_NUM_32 = 32, GPIO_NUM_33 = 33, GPIO_NUM_34 = 34, GPIO_NUM_35 = 35, GPIO_NUM_36 = 36, GPIO_NUM_39 = 39,
+} gpio_num_t;
+
+typedef enum { FM_QIO, FM_QOUT, FM_DIO, FM_DOUT, FM_FAST_READ, FM_SLOW_READ, FM_UNKNOWN = 0xff } FlashMode_t;
+
+inline uint32_t& host_cpu_frequency()
+{
+    static uint32_t mhz = 240;
+    return mhz;
+}
+inline bool setCpuFrequencyMhz(uint32_t mhz)
+{
+    host_cpu_frequency() = mhz;
+    return true;
+}
+inline uint32_t getCpuFrequencyMhz() { return host_cpu_frequency(); }
+inline bool btStop() { return true; }
+
+class String
+{
+    std::string s;
+
+public:
+    String(const char* str = "") : s(str ? str : "") {}
+    String(const std::string& str) : s(str) {}
+    String(int value) : s(std::to_string(value)) {}
+    const char* c_str() const { return s.c_str(); }
+    size_t length() const { return s.size(); }
+    bool equals(const String& other) const { return s == other.s; }
+    bool operator==(const String& other) const { return s == other.s; }
+    bool operator==(const char* other) const { return s == other; }
+    String& operator+=(const String& other) { s += other.s; return *this; }
+    String operator+(const String& other) const { return String(s + other.s); }
+    char operator[](size_t i) const { return s[i]; }
+};
+
+class Print
+{
+public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t* buffer, size_t size)
+    {
+        size_t n = 0;
+        while (size--)
+            n += write(*buffer++);
+        return n;
+    }
+    size_t write(const char* str) { return write((const uint8_t*)str, strlen(str)); }
+    size_t write(const char* buffer, size_t size) { return write((const uint8_t*)buffer, size); }
+    size_t printf(const char* format, ...) __attribute__((format(printf, 2, 3)))
+    {
+        char buf[512];
+        va_list args;
+        va_start(args, format);
+        int len = host_vsnprintf(buf, sizeof(buf), format, args);
+        va_end(args);
+        return len < 0 ? 0 : write((const uint8_t*)buf, (size_t)len < sizeof(buf) ? len : sizeof(buf) - 1);
+    }
+    size_t print(const char* str) { return write(str); }
+    size_t print(const String& str) { return write(str.c_str()); }
+    size_t print(long value)
+    {
+        char buf[24];
+        snprintf(buf, sizeof(buf), "%ld", value);
+        return write(buf);
+    }
+    size_t println(const char* str = "") { return print(str) + write("\n"); }
+    size_t println(const String& str) { return println(str.c_str()); }
+    size_t println(long value) { return print(value) + write("\n"); }
+    virtual void flush() {}
+};
+
+class Stream : public Print
+{
+public:
+    virtual int available() = 0;
+    virtual int read() = 0;
+    virtual int peek() { return -1; }
+    size_t readBytes(uint8_t* buffer, size_t length)
+    {
+        size_t n = 0;
+        for (int c; n < length && (c = read()) >= 0; n++)
+            buffer[n] = c;
+        return n;
+    }
+    size_t readBytes(char* buffer, size_t length) { return readBytes((uint8_t*)buffer, length); }
+};
+
+// Serial console on stdout, input is fed by the host program through feed(), from any thread
+class HardwareSerial : public Stream
+{
+    std::string rx;
+    std::mutex rxMutex;
+
+public:
+    void begin(unsigned long baud) {}
+    size_t write(uint8_t c) { return fwrite(&c, 1, 1, stdout); }
+    size_t write(const uint8_t* buffer, size_t size) { return fwrite(buffer, 1, size, stdout); }
+    using Print::write;
+    void flush() { fflush(stdout); }
+    int available()
+    {
+        std::lock_guard<std::mutex> lock(rxMutex);
+        return rx.size();
+    }
+    int availableForWrite() { return 128; }
+    int read()
+    {
+        std::lock_guard<std::mutex> lock(rxMutex);
+        if (rx.empty())
+            return -1;
+        int c = (uint8_t)rx[0];
+        rx.erase(0, 1);
+        return c;
+    }
+    int peek()
+    {
+        std::lock_guard<std::mutex> lock(rxMutex);
+        return rx.empty() ? -1 : (uint8_t)rx[0];
+    }
+    void feed(const char* data)
+    {
+        std::lock_guard<std::mutex> lock(rxMutex);
+        rx += data;
+    }
+};
+inline HardwareSerial Serial;
+
+#ifndef HOST_EFUSE_MAC
+#define HOST_EFUSE_MAC 0 // The native_ui env set the MAC of the device, setup() stop on any other
+#endif
+
+// Chip information of a 4 MB ESP32 with the heap of the firmware after boot, restart() end the process
+class EspClass
+{
+public:
+    uint64_t getEfuseMac() { return HOST_EFUSE_MAC; }
+    const char* getSdkVersion() { return "host"; }
+    uint32_t getCpuFreqMHz() { return getCpuFrequencyMhz(); }
+    uint32_t getHeapSize() { return 327680; }
+    uint32_t getFreeHeap() { return heap_caps_get_free_size(MALLOC_CAP_DEFAULT); }
+    uint32_t getMinFreeHeap() { return heap_caps_get_minimum_free_size(MALLOC_CAP_DEFAULT); }
+    uint32_t getMaxAllocHeap() { return heap_caps_get_largest_free_block(MALLOC_CAP_DEFAULT); }
+    uint32_t getFlashChipSize() { return 4 * 1024 * 1024; }
+    String getSketchMD5() { return "00000000000000000000000000000000"; }
+    void restart()
+    {
+        fflush(stdout);
+        fprintf(stderr, "ESP.restart()\n");
+        _Exit(0);
+    }
+};
+inline EspClass ESP;
+#endif
+
+// Firmware code formatting by itself (sys_stats.h) get the ESP32 "%lu" too
+#define vsnprintf host_vsnprintf
@@ -0,0 +1,40 @@
+#pragma once
+// Host stand-in of the ESP8266Audio file source, reading from the SD directory of SD.h
+#include <SD.h>
+
+class AudioFileSource
+{
+public:
+    virtual ~AudioFileSource() {}
+    virtual bool open(const char* filename) = 0;
+    virtual uint32_t read(void* data, uint32_t len) = 0;
+    virtual bool seek(int32_t pos, int dir) = 0;
+    virtual bool close() = 0;
+    virtual bool isOpen() = 0;
+    virtual uint32_t getSize() = 0;
+    virtual uint32_t getPos() = 0;
+};
+
+class AudioFileSourceSD : public AudioFileSource
+{
+    File f;
+
+public:
+    AudioFileSourceSD() {}
+    AudioFileSourceSD(const char* filename) { open(filename); }
+    bool open(const char* filename)
+    {
+        f = SD.open(filename, FILE_READ);
+        return f;
+    }
+    uint32_t read(void* data, uint32_t len) { return f.read((uint8_t*)data, len); }
+    bool seek(int32_t pos, int dir) { return f.seek(pos, (SeekMode)dir); }
+    bool close()
+    {
+        f.close();
+        return true;
+    }
+    bool isOpen() { return f; }
+    uint32_t getSize() { return f.size(); }
+    uint32_t getPos() { return f.position(); }
+};
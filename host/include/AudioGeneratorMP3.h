@@ -0,0 +1,83 @@
+#pragma once
+// Host stand-in of the ESP8266Audio MP3 generator. Nothing is decoded : the bitrate and sample rate come from the first
+// frame header and loop() read the file and feed silence to the output at that pace, so a bell last as long as its
+// audio file on the device and a missing or truncated file end it the same way
+#include "AudioFileSourceSD.h"
+#include "AudioOutputI2S.h"
+
+class AudioGeneratorMP3
+{
+    AudioFileSource* file = nullptr;
+    AudioOutput* output = nullptr;
+    bool running = false;
+    uint32_t bitrate = 0; // bit/s
+    uint64_t startUs = 0, samplesOut = 0;
+    uint32_t bytesRead = 0;
+
+    // Bitrate and sample rate of the MPEG audio frame header at the file position, after an ID3v2 tag if any
+    bool readHeader()
+    {
+        uint8_t h[10];
+        if (file->read(h, 10) != 10)
+            return false;
+        uint32_t start = 0;
+        if (memcmp(h, "ID3", 3) == 0)
+            start = 10 + ((h[6] & 0x7F) << 21 | (h[7] & 0x7F) << 14 | (h[8] & 0x7F) << 7 | (h[9] & 0x7F));
+        if (!file->seek(start, SEEK_SET) || file->read(h, 4) != 4 || h[0] != 0xFF || (h[1] & 0xE0) != 0xE0)
+            return false;
+        static const uint16_t mpeg1[16] = { 0, 32, 40, 48, 56, 64, 80, 96, 112, 128, 160, 192, 224, 256, 320, 0 };
+        static const uint16_t mpeg2[16] = { 0, 8, 16, 24, 32, 40, 48, 56, 64, 80, 96, 112, 128, 144, 160, 0 };
+        static const uint32_t rates[4] = { 44100, 48000, 32000, 0 };
+        uint8_t version = (h[1] >> 3) & 3; // 3 MPEG 1, 2 MPEG 2, 0 MPEG 2.5
+        bitrate = (version == 3 ? mpeg1 : mpeg2)[h[2] >> 4] * 1000;
+        uint32_t hz = rates[(h[2] >> 2) & 3] >> (version == 3 ? 0 : version == 2 ? 1 : 2);
+        if (!bitrate || !hz)
+            return false;
+        output->SetRate(hz);
+        bytesRead = file->getPos();
+        return true;
+    }
+
+public:
+    bool begin(AudioFileSource* source, AudioOutput* out)
+    {
+        file = source;
+        output = out;
+        running = file && output && file->isOpen() && readHeader();
+        if (!running)
+            return false;
+        output->begin();
+        startUs = host_micros64();
+        samplesOut = 0;
+        return true;
+    }
+    bool loop()
+    {
+        if (!running)
+            return false;
+        // Bytes and samples due by now at the file bitrate
+        uint64_t elapsedUs = host_micros64() - startUs;
+        uint64_t bytesDue = elapsedUs * (bitrate / 8) / 1000000;
+        uint8_t chunk[512];
+        while (bytesRead < bytesDue) {
+            uint32_t len = file->read(chunk, bytesDue - bytesRead < sizeof(chunk) ? bytesDue - bytesRead : sizeof(chunk));
+            if (!len) {
+                running = false;
+                return false;
+            }
+            bytesRead += len;
+        }
+        int16_t silence[2] = { 0, 0 };
+        for (uint64_t due = elapsedUs * output->hertz / 1000000; samplesOut < due; samplesOut++)
+            output->ConsumeSample(silence);
+        return true;
+    }
+    bool stop()
+    {
+        running = false;
+        if (output)
+            output->stop();
+        return true;
+    }
+    bool isRunning() { return running; }
+};
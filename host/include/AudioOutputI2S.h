@@ -0,0 +1,37 @@
+#pragma once
+// Host stand-in of the ESP8266Audio I2S output : a sink that count the samples and keep the gain, nothing is played
+#include <Arduino.h>
+
+class AudioOutput
+{
+public:
+    float gain = 1.0;
+    uint32_t hertz = 44100;
+    uint64_t samples = 0; // Consumed since boot
+
+    virtual ~AudioOutput() {}
+    virtual bool SetRate(int hz)
+    {
+        hertz = hz;
+        return true;
+    }
+    virtual bool SetGain(float f)
+    {
+        gain = f;
+        return true;
+    }
+    virtual bool begin() { return true; }
+    virtual bool ConsumeSample(int16_t sample[2])
+    {
+        samples++;
+        return true;
+    }
+    virtual bool stop() { return true; }
+};
+
+class AudioOutputI2S : public AudioOutput
+{
+public:
+    AudioOutputI2S(int port = 0, int outputMode = 0, int dmaBufCount = 8, int useApll = 0) {}
+    bool SetPinout(int bclkPin, int wclkPin, int doutPin) { return true; }
+};
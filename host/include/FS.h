@@ -0,0 +1,213 @@
+#pragma once
+// Host stand-in of the Arduino ESP32 FS on a directory of the host. Paths are the ones of the firmware ("/espsys/..."),
+// resolved under the root given to the filesystem. Same semantics as the ESP32 VFS where the firmware rely on them :
+// File copies share one handle, name() is the base name, "w" doesn't create directories and directory entries come
+// one by one from openNextFile() (sorted by name here, in FAT order on the device)
+#include <Arduino.h>
+#include <dirent.h>
+#include <errno.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <algorithm>
+#include <memory>
+#include <string>
+#include <vector>
+
+#define FILE_READ "r"
+#define FILE_WRITE "w"
+#define FILE_APPEND "a"
+
+namespace fs
+{
+
+enum SeekMode { SeekSet = 0, SeekCur = 1, SeekEnd = 2 };
+
+struct FileImpl
+{
+    std::string hostPath, path;
+    FILE* fp = nullptr;
+    bool directory = false;
+    std::vector<std::string> entries; // Directory entries not returned by openNextFile() yet
+    size_t nextEntry = 0;
+
+    ~FileImpl()
+    {
+        if (fp)
+            fclose(fp);
+    }
+};
+
+class File : public Stream
+{
+    std::shared_ptr<FileImpl> impl;
+
+public:
+    File() {}
+    File(std::shared_ptr<FileImpl> _impl) : impl(_impl) {}
+
+    operator bool() const { return impl && (impl->fp || impl->directory); }
+    const char* path() const { return impl ? impl->path.c_str() : nullptr; }
+    const char* name() const
+    {
+        if (!impl)
+            return nullptr;
+        const char* slash = strrchr(impl->path.c_str(), '/');
+        return slash && slash[1] ? slash + 1 : impl->path.c_str();
+    }
+    bool isDirectory() { return impl && impl->directory; }
+    size_t size() const
+    {
+        struct stat st;
+        if (!*this || impl->directory)
+            return 0;
+        fflush(impl->fp);
+        return fstat(fileno(impl->fp), &st) == 0 ? st.st_size : 0;
+    }
+    time_t getLastWrite()
+    {
+        struct stat st;
+        return impl && stat(impl->hostPath.c_str(), &st) == 0 ? st.st_mtime : 0;
+    }
+    size_t position() const { return impl && impl->fp ? ftell(impl->fp) : 0; }
+    bool seek(uint32_t pos, SeekMode mode = SeekSet) { return impl && impl->fp && fseek(impl->fp, pos, mode) == 0; }
+    void close()
+    {
+        if (impl && impl->fp) {
+            fclose(impl->fp);
+            impl->fp = nullptr;
+        }
+        if (impl)
+            impl->directory = false;
+    }
+
+    size_t write(uint8_t c) { return write(&c, 1); }
+    size_t write(const uint8_t* buffer, size_t size) { return impl && impl->fp ? fwrite(buffer, 1, size, impl->fp) : 0; }
+    using Print::write;
+    void flush()
+    {
+        if (impl && impl->fp)
+            fflush(impl->fp);
+    }
+    int available() { return *this && !impl->directory ? size() - position() : 0; }
+    int read()
+    {
+        uint8_t c;
+        return read(&c, 1) == 1 ? c : -1;
+    }
+    size_t read(uint8_t* buffer, size_t size) { return impl && impl->fp ? fread(buffer, 1, size, impl->fp) : 0; }
+    int peek()
+    {
+        if (!impl || !impl->fp)
+            return -1;
+        int c = fgetc(impl->fp);
+        if (c != EOF)
+            ungetc(c, impl->fp);
+        return c == EOF ? -1 : c;
+    }
+
+    File openNextFile(const char* mode = FILE_READ);
+    // Path of the next entry without opening it, empty at the end
+    String getNextFileName(bool* isDir);
+    String getNextFileName()
+    {
+        bool isDir;
+        return getNextFileName(&isDir);
+    }
+    // Continue the listing from the position-th entry, counted like telldir() of the FAT VFS
+    bool seekDir(long position)
+    {
+        if (!impl || !impl->directory)
+            return false;
+        impl->nextEntry = position;
+        return true;
+    }
+    void rewindDirectory()
+    {
+        if (impl)
+            impl->nextEntry = 0;
+    }
+};
+
+class FS
+{
+protected:
+    std::string root;
+
+public:
+    FS(const char* _root) : root(_root) {}
+
+    // Directory of the host the paths are resolved under
+    void hostRoot(const char* dir) { root = dir; }
+    const char* hostRoot() const { return root.c_str(); }
+    std::string hostPath(const char* path) const { return root + (path[0] == '/' ? "" : "/") + path; }
+
+    File open(const char* path, const char* mode = FILE_READ, bool create = false)
+    {
+        std::shared_ptr<FileImpl> impl = std::make_shared<FileImpl>();
+        impl->path = path;
+        impl->hostPath = hostPath(path);
+        struct stat st;
+        bool exists = stat(impl->hostPath.c_str(), &st) == 0;
+        if (exists && S_ISDIR(st.st_mode)) {
+            if (mode[0] != 'r')
+                return File();
+            impl->directory = true;
+            if (DIR* dir = opendir(impl->hostPath.c_str())) {
+                while (struct dirent* entry = readdir(dir))
+                    if (strcmp(entry->d_name, ".") != 0 && strcmp(entry->d_name, ".."))
+                        impl->entries.push_back(entry->d_name);
+                closedir(dir);
+            }
+            std::sort(impl->entries.begin(), impl->entries.end());
+            return File(impl);
+        }
+        if (!exists && mode[0] == 'r') {
+            log_e("%s does not exist, no permits for creation", impl->hostPath.c_str());
+            return File();
+        }
+        if (create && mode[0] != 'r')
+            for (size_t slash = impl->hostPath.find('/', root.size() + 1); slash != std::string::npos;
+                 slash = impl->hostPath.find('/', slash + 1))
+                ::mkdir(impl->hostPath.substr(0, slash).c_str(), 0755);
+        std::string fmode = std::string(mode) + "b";
+        impl->fp = fopen(impl->hostPath.c_str(), fmode.c_str());
+        return impl->fp ? File(impl) : File();
+    }
+    bool exists(const char* path)
+    {
+        struct stat st;
+        return stat(hostPath(path).c_str(), &st) == 0;
+    }
+    bool remove(const char* path) { return unlink(hostPath(path).c_str()) == 0; }
+    bool rename(const char* from, const char* to) { return ::rename(hostPath(from).c_str(), hostPath(to).c_str()) == 0; }
+    bool mkdir(const char* path) { return ::mkdir(hostPath(path).c_str(), 0755) == 0 || errno == EEXIST; }
+    bool rmdir(const char* path) { return ::rmdir(hostPath(path).c_str()) == 0; }
+};
+
+inline File File::openNextFile(const char* mode)
+{
+    if (!impl || !impl->directory || impl->nextEntry >= impl->entries.size())
+        return File();
+    std::string child = impl->path + (impl->path.back() == '/' ? "" : "/") + impl->entries[impl->nextEntry++];
+    std::string hostRoot = impl->hostPath.substr(0, impl->hostPath.size() - impl->path.size());
+    return FS(hostRoot.c_str()).open(child.c_str(), mode);
+}
+
+inline String File::getNextFileName(bool* isDir)
+{
+    struct stat st;
+    if (!impl || !impl->directory || impl->nextEntry >= impl->entries.size())
+        return String();
+    const std::string& entry = impl->entries[impl->nextEntry++];
+    *isDir = stat((impl->hostPath + "/" + entry).c_str(), &st) == 0 && S_ISDIR(st.st_mode);
+    return String(impl->path + (impl->path.back() == '/' ? "" : "/") + entry);
+}
+
+}
+
+using fs::File;
+using fs::FS;
+using fs::SeekMode;
+using fs::SeekSet;
+using fs::SeekCur;
+using fs::SeekEnd;
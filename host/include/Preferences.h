@@ -0,0 +1,41 @@
+#pragma once
+// Host stand-in of the Preferences (NVS) library, kept in RAM for the life of the process
+#include <Arduino.h>
+#include <map>
+#include <vector>
+
+class Preferences
+{
+    std::string nameSpace;
+
+    static std::map<std::string, std::vector<uint8_t>>& storage()
+    {
+        static std::map<std::string, std::vector<uint8_t>> nvs;
+        return nvs;
+    }
+    std::string path(const char* key) { return nameSpace + "/" + key; }
+
+public:
+    bool begin(const char* name, bool readOnly = false)
+    {
+        nameSpace = name;
+        return true;
+    }
+    void end() {}
+    bool isKey(const char* key) { return storage().count(path(key)); }
+    size_t getBytesLength(const char* key) { return isKey(key) ? storage()[path(key)].size() : 0; }
+    size_t getBytes(const char* key, void* buf, size_t maxLen)
+    {
+        if (!isKey(key))
+            return 0;
+        std::vector<uint8_t>& value = storage()[path(key)];
+        size_t len = value.size() < maxLen ? value.size() : maxLen;
+        memcpy(buf, value.data(), len);
+        return len;
+    }
+    size_t putBytes(const char* key, const void* value, size_t len)
+    {
+        storage()[path(key)].assign((const uint8_t*)value, (const uint8_t*)value + len);
+        return len;
+    }
+};
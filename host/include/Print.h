@@ -0,0 +1,3 @@
+#pragma once
+// Print and Stream are declared by the host Arduino.h, this header exist for the libraries including it directly
+#include <Arduino.h>
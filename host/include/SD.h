@@ -0,0 +1,44 @@
+#pragma once
+// Host stand-in of the Arduino ESP32 SD library, the card is the directory set with SD.hostRoot() ("host_sd" by
+// default). begin() fail when it doesn't exist, like a missing card
+#include <FS.h>
+#include <SPI.h>
+#include <sys/statvfs.h>
+
+typedef enum { CARD_NONE, CARD_MMC, CARD_SD, CARD_SDHC, CARD_UNKNOWN } sdcard_type_t;
+
+namespace fs
+{
+
+class SDFS : public FS
+{
+    bool mounted = false;
+
+    uint64_t hostBytes(bool used)
+    {
+        struct statvfs st;
+        if (!mounted || statvfs(root.c_str(), &st) != 0)
+            return 0;
+        return (uint64_t)st.f_frsize * (used ? st.f_blocks - st.f_bfree : st.f_blocks);
+    }
+
+public:
+    SDFS() : FS("host_sd") {}
+    bool begin(uint8_t ssPin = 5, SPIClass& spi = SPI, uint32_t frequency = 4000000, const char* mountpoint = "/sd",
+        uint8_t maxFiles = 5, bool formatIfEmpty = false)
+    {
+        struct stat st;
+        mounted = stat(root.c_str(), &st) == 0 && S_ISDIR(st.st_mode);
+        return mounted;
+    }
+    void end() { mounted = false; }
+    sdcard_type_t cardType() { return mounted ? CARD_SDHC : CARD_NONE; }
+    uint64_t cardSize() { return hostBytes(false); }
+    uint64_t totalBytes() { return hostBytes(false); }
+    uint64_t usedBytes() { return hostBytes(true); }
+};
+
+}
+
+using fs::SDFS;
+inline SDFS SD;
@@ -0,0 +1,32 @@
+#pragma once
+// Host stand-in of the Arduino ESP32 SPIClass, nothing is on the bus : the SD card is a host directory (SD.h) and the
+// display a framebuffer (lgfx_host.h)
+#include <Arduino.h>
+
+#define HSPI 2
+#define VSPI 3
+#define SPI_MODE0 0
+#define MSBFIRST 1
+
+class SPISettings
+{
+public:
+    SPISettings(uint32_t clock = 1000000, uint8_t bitOrder = MSBFIRST, uint8_t dataMode = SPI_MODE0) {}
+};
+
+class SPIClass
+{
+    uint32_t frequency = 1000000;
+
+public:
+    SPIClass(uint8_t spiBus = HSPI) {}
+    void begin(int8_t sck = -1, int8_t miso = -1, int8_t mosi = -1, int8_t ss = -1) {}
+    void end() {}
+    void setFrequency(uint32_t freq) { frequency = freq; }
+    uint32_t getClockDivider() { return 80000000 / frequency; }
+    void beginTransaction(SPISettings settings) {}
+    void endTransaction() {}
+    uint8_t transfer(uint8_t data) { return 0xFF; }
+    void transfer(void* data, uint32_t size) { memset(data, 0xFF, size); }
+};
+inline SPIClass SPI(VSPI);
@@ -0,0 +1,22 @@
+#pragma once
+// Host stand-in of the Arduino ESP32 SPIFFS, on the "host_spiffs" directory
+#include <FS.h>
+
+namespace fs
+{
+
+class SPIFFSFS : public FS
+{
+public:
+    SPIFFSFS() : FS("host_spiffs") {}
+    bool begin(bool formatOnFail = false, const char* basePath = "/spiffs", uint8_t maxOpenFiles = 10, const char* partitionLabel = NULL)
+    {
+        return mkdir("/");
+    }
+    void end() {}
+};
+
+}
+
+using fs::SPIFFSFS;
+inline SPIFFSFS SPIFFS;
@@ -0,0 +1,60 @@
+#pragma once
+// Host stand-in of the Arduino ESP32 Update, the image is written to "firmware_update.bin" of the working directory
+// instead of the OTA partition
+#include <Arduino.h>
+
+#define UPDATE_SIZE_UNKNOWN 0xFFFFFFFF
+#define U_FLASH 0
+
+class UpdateClass
+{
+    FILE* image = nullptr;
+    size_t expected = 0, written = 0;
+    const char* error = "No Error";
+
+public:
+    bool begin(size_t size = UPDATE_SIZE_UNKNOWN, int command = U_FLASH)
+    {
+        abort();
+        image = fopen("firmware_update.bin", "wb");
+        expected = size;
+        written = 0;
+        error = image ? "No Error" : "Could Not Open Image";
+        return image;
+    }
+    size_t write(uint8_t* data, size_t len)
+    {
+        if (!image || (expected != UPDATE_SIZE_UNKNOWN && written + len > expected)) {
+            error = "Bad Size Given";
+            return 0;
+        }
+        len = fwrite(data, 1, len, image);
+        written += len;
+        return len;
+    }
+    bool end(bool evenIfRemaining = false)
+    {
+        if (!image)
+            return false;
+        fclose(image);
+        image = nullptr;
+        if (!evenIfRemaining && expected != UPDATE_SIZE_UNKNOWN && written != expected) {
+            error = "Bad Size Given";
+            return false;
+        }
+        return true;
+    }
+    void abort()
+    {
+        if (image)
+            fclose(image);
+        image = nullptr;
+        error = "Aborted";
+    }
+    bool isFinished() { return !image && written && (expected == UPDATE_SIZE_UNKNOWN || written == expected); }
+    bool hasError() { return strcmp(error, "No Error") != 0; }
+    const char* errorString() { return error; }
+    size_t progress() { return written; }
+    size_t size() { return expected; }
+};
+inline UpdateClass Update;
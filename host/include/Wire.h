@@ -0,0 +1,68 @@
+#pragma once
+// Host stand-in of the Arduino TwoWire. Devices are fakes attached to an address (host_devices.h), any other address
+// NACK and read nothing. Drivers tested on the host without Wire take a bus interface instead (pcf8574Bus)
+#include <Arduino.h>
+#include <vector>
+
+// A device on the fake bus, each call is one whole transaction
+class TwoWireDevice
+{
+public:
+    virtual ~TwoWireDevice() {}
+    virtual void receive(const uint8_t* data, size_t len) = 0; // Master write
+    virtual void request(uint8_t* data, size_t len) = 0; // Master read
+};
+
+class TwoWire : public Stream
+{
+    TwoWireDevice* devices[128] = {};
+    uint8_t txAddress = 0;
+    bool txActive = false;
+    std::vector<uint8_t> tx, rx;
+    size_t rxPos = 0;
+
+public:
+    void attach(uint8_t address, TwoWireDevice* device) { devices[address & 0x7F] = device; }
+
+    bool begin(int sda = -1, int scl = -1, uint32_t frequency = 0) { return true; }
+    bool setClock(uint32_t frequency) { return true; }
+    void setTimeOut(uint16_t timeOutMillis) {}
+    void beginTransmission(uint16_t address)
+    {
+        txAddress = address & 0x7F;
+        txActive = true;
+        tx.clear();
+    }
+    uint8_t endTransmission(bool sendStop = true)
+    {
+        if (!txActive)
+            return 0;
+        txActive = false;
+        if (!devices[txAddress])
+            return 2; // Address NACK
+        devices[txAddress]->receive(tx.data(), tx.size());
+        return 0;
+    }
+    uint8_t requestFrom(uint16_t address, uint8_t size, bool sendStop = true)
+    {
+        rx.clear();
+        rxPos = 0;
+        if (!devices[address & 0x7F])
+            return 0;
+        rx.resize(size);
+        devices[address & 0x7F]->request(rx.data(), size);
+        return size;
+    }
+    size_t write(uint8_t c)
+    {
+        if (!txActive)
+            return 0;
+        tx.push_back(c);
+        return 1;
+    }
+    using Print::write;
+    int available() { return rx.size() - rxPos; }
+    int read() { return rxPos < rx.size() ? rx[rxPos++] : -1; }
+    int peek() { return rxPos < rx.size() ? rx[rxPos] : -1; }
+};
+inline TwoWire Wire;
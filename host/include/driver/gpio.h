@@ -0,0 +1,21 @@
+#pragma once
+// Host stand-in of the ESP-IDF GPIO driver, interrupt and wake up settings are accepted and ignored
+#include <Arduino.h>
+
+typedef int esp_err_t;
+#define ESP_OK 0
+
+typedef enum {
+    GPIO_INTR_DISABLE = 0,
+    GPIO_INTR_POSEDGE,
+    GPIO_INTR_NEGEDGE,
+    GPIO_INTR_ANYEDGE,
+    GPIO_INTR_LOW_LEVEL,
+    GPIO_INTR_HIGH_LEVEL,
+} gpio_int_type_t;
+
+inline esp_err_t gpio_intr_enable(gpio_num_t gpio) { return ESP_OK; }
+inline esp_err_t gpio_intr_disable(gpio_num_t gpio) { return ESP_OK; }
+inline esp_err_t gpio_set_intr_type(gpio_num_t gpio, gpio_int_type_t type) { return ESP_OK; }
+inline esp_err_t gpio_wakeup_enable(gpio_num_t gpio, gpio_int_type_t type) { return ESP_OK; }
+inline esp_err_t gpio_wakeup_disable(gpio_num_t gpio) { return ESP_OK; }
@@ -0,0 +1,20 @@
+#pragma once
+// Host stand-in of the ESP32 heap_caps API. Allocations come from malloc, the sizes are the ones of the firmware
+// after boot on the device so the "heap" telemetry keep its shape
+#include <stdint.h>
+#include <stdlib.h>
+
+#define MALLOC_CAP_EXEC (1 << 0)
+#define MALLOC_CAP_32BIT (1 << 1)
+#define MALLOC_CAP_8BIT (1 << 2)
+#define MALLOC_CAP_DMA (1 << 3)
+#define MALLOC_CAP_SPIRAM (1 << 10)
+#define MALLOC_CAP_INTERNAL (1 << 11)
+#define MALLOC_CAP_DEFAULT (1 << 12)
+
+inline void* heap_caps_malloc(size_t size, uint32_t caps) { return malloc(size); }
+inline void* heap_caps_calloc(size_t n, size_t size, uint32_t caps) { return calloc(n, size); }
+inline void heap_caps_free(void* ptr) { free(ptr); }
+inline size_t heap_caps_get_free_size(uint32_t caps) { return 180000; }
+inline size_t heap_caps_get_minimum_free_size(uint32_t caps) { return 160000; }
+inline size_t heap_caps_get_largest_free_block(uint32_t caps) { return 110000; }
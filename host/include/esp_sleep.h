@@ -0,0 +1,62 @@
+#pragma once
+// Host stand-in of the ESP32 light sleep. esp_light_sleep_start() block the calling thread until the timer wake up,
+// or until Serial has input when the UART wake up is enabled. The other threads keep running, on the device they are
+// held by the locks the caller take around the sleep
+#include <Arduino.h>
+
+typedef int esp_err_t;
+#ifndef ESP_OK
+#define ESP_OK 0
+#endif
+
+typedef enum {
+    ESP_SLEEP_WAKEUP_UNDEFINED,
+    ESP_SLEEP_WAKEUP_ALL,
+    ESP_SLEEP_WAKEUP_EXT0,
+    ESP_SLEEP_WAKEUP_EXT1,
+    ESP_SLEEP_WAKEUP_TIMER,
+    ESP_SLEEP_WAKEUP_TOUCHPAD,
+    ESP_SLEEP_WAKEUP_ULP,
+    ESP_SLEEP_WAKEUP_GPIO,
+    ESP_SLEEP_WAKEUP_UART,
+} esp_sleep_wakeup_cause_t;
+
+struct HostSleep
+{
+    uint64_t timerUs = 0;
+    bool uartWakeup = false;
+    esp_sleep_wakeup_cause_t cause = ESP_SLEEP_WAKEUP_UNDEFINED;
+};
+inline HostSleep& host_sleep()
+{
+    static HostSleep sleep;
+    return sleep;
+}
+
+inline esp_err_t esp_sleep_enable_timer_wakeup(uint64_t us)
+{
+    host_sleep().timerUs = us;
+    return ESP_OK;
+}
+inline esp_err_t esp_sleep_enable_gpio_wakeup() { return ESP_OK; }
+inline esp_err_t esp_sleep_enable_uart_wakeup(int uart)
+{
+    host_sleep().uartWakeup = true;
+    return ESP_OK;
+}
+inline esp_sleep_wakeup_cause_t esp_sleep_get_wakeup_cause() { return host_sleep().cause; }
+
+inline esp_err_t esp_light_sleep_start()
+{
+    HostSleep& sleep = host_sleep();
+    uint64_t end = host_micros64() + sleep.timerUs;
+    sleep.cause = ESP_SLEEP_WAKEUP_TIMER;
+    for (uint64_t now; (now = host_micros64()) < end;) {
+        if (sleep.uartWakeup && Serial.available()) {
+            sleep.cause = ESP_SLEEP_WAKEUP_UART;
+            break;
+        }
+        delayMicroseconds(end - now < 5000 ? end - now : 5000);
+    }
+    return ESP_OK;
+}
@@ -0,0 +1,5 @@
+#pragma once
+// Host stand-in of esp_timer, the monotonic clock of Arduino.h
+#include <Arduino.h>
+
+inline int64_t esp_timer_get_time() { return host_micros64(); }
@@ -0,0 +1,388 @@
+#pragma once
+// Host stand-in of the ESP32 FreeRTOS API used by the firmware : tasks are threads, semaphores, queues and task
+// notifications are built on a mutex and a condition variable. A tick is a millisecond and critical sections are
+// recursive mutexes, priorities and core pinning are only kept for the task list
+#include <Arduino.h>
+#include <pthread.h>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+typedef uint32_t TickType_t;
+typedef uint32_t StackType_t;
+
+#define pdTRUE 1
+#define pdFALSE 0
+#define pdPASS 1
+#define pdFAIL 0
+#define errQUEUE_FULL 0
+#define portMAX_DELAY 0xffffffffUL
+#define configTICK_RATE_HZ 1000
+#define portTICK_PERIOD_MS 1
+#define pdMS_TO_TICKS(ms) ((TickType_t)(ms))
+#define configMAX_PRIORITIES 25
+#define tskIDLE_PRIORITY 0
+#define tskNO_AFFINITY 0x7FFFFFFF
+
+struct portMUX_TYPE
+{
+    std::recursive_mutex mutex;
+};
+#define portMUX_INITIALIZER_UNLOCKED {}
+#define portENTER_CRITICAL(mux) (mux)->mutex.lock()
+#define portEXIT_CRITICAL(mux) (mux)->mutex.unlock()
+#define portENTER_CRITICAL_ISR(mux) portENTER_CRITICAL(mux)
+#define portEXIT_CRITICAL_ISR(mux) portEXIT_CRITICAL(mux)
+#define portENTER_CRITICAL_SAFE(mux) portENTER_CRITICAL(mux)
+#define portEXIT_CRITICAL_SAFE(mux) portEXIT_CRITICAL(mux)
+#define portYIELD_FROM_ISR(...) do {} while (0)
+
+// Wait on cv until ready() or the ticks ran out, with lock held. Return ready()
+template <typename Ready>
+inline bool host_wait(std::condition_variable& cv, std::unique_lock<std::mutex>& lock, TickType_t ticks, Ready ready)
+{
+    if (ticks == portMAX_DELAY) {
+        cv.wait(lock, ready);
+        return true;
+    }
+    return cv.wait_for(lock, std::chrono::milliseconds(ticks), ready);
+}
+
+// ---- Tasks ----
+
+typedef enum { eRunning, eReady, eBlocked, eSuspended, eDeleted, eInvalid } eTaskState;
+
+struct HostTask
+{
+    std::string name;
+    UBaseType_t priority;
+    BaseType_t coreId;
+    UBaseType_t number;
+    pthread_t thread;
+    bool deleted = false;
+    std::mutex notifyMutex;
+    std::condition_variable notifyCv;
+    uint32_t notifyValue = 0;
+};
+typedef HostTask* TaskHandle_t;
+typedef void (*TaskFunction_t)(void*);
+
+typedef struct {
+    TaskHandle_t xHandle;
+    const char* pcTaskName;
+    UBaseType_t xTaskNumber;
+    eTaskState eCurrentState;
+    UBaseType_t uxCurrentPriority;
+    UBaseType_t uxBasePriority;
+    uint32_t ulRunTimeCounter;
+    StackType_t* pxStackBase;
+    uint32_t usStackHighWaterMark;
+    BaseType_t xCoreID;
+} TaskStatus_t;
+
+// Every task ever created, never freed so a handle stay valid after vTaskDelete() like a FreeRTOS handle that
+// isn't reused yet. The thread running setup() and loop() is "loopTask" on core 1
+struct HostTaskList
+{
+    std::mutex mutex;
+    std::vector<HostTask*> tasks;
+};
+inline HostTaskList& host_tasks()
+{
+    static HostTaskList list;
+    return list;
+}
+inline HostTask* host_task_add(const char* name, UBaseType_t priority, BaseType_t coreId)
+{
+    HostTask* task = new HostTask();
+    task->name = name;
+    task->priority = priority;
+    task->coreId = coreId;
+    task->thread = pthread_self();
+    std::lock_guard<std::mutex> lock(host_tasks().mutex);
+    task->number = host_tasks().tasks.size() + 1;
+    host_tasks().tasks.push_back(task);
+    return task;
+}
+inline thread_local HostTask* host_current_task = nullptr;
+
+struct HostTaskExit
+{
+};
+
+inline TaskHandle_t xTaskGetCurrentTaskHandle()
+{
+    if (!host_current_task)
+        host_current_task = host_task_add("loopTask", 1, 1);
+    return host_current_task;
+}
+
+inline BaseType_t xTaskCreatePinnedToCore(TaskFunction_t function, const char* name, uint32_t stackDepth, void* param,
+    UBaseType_t priority, TaskHandle_t* created, BaseType_t coreId)
+{
+    HostTask* task = host_task_add(name, priority, coreId);
+    if (created)
+        *created = task;
+    std::thread([task, function, param]() {
+        host_current_task = task;
+        task->thread = pthread_self();
+        pthread_setname_np(pthread_self(), task->name.substr(0, 15).c_str());
+        try {
+            function(param);
+        }
+        catch (HostTaskExit&) {
+        }
+        task->deleted = true;
+    }).detach();
+    return pdPASS;
+}
+inline BaseType_t xTaskCreate(TaskFunction_t function, const char* name, uint32_t stackDepth, void* param,
+    UBaseType_t priority, TaskHandle_t* created)
+{
+    return xTaskCreatePinnedToCore(function, name, stackDepth, param, priority, created, tskNO_AFFINITY);
+}
+
+// Only a task can delete itself, which unwind its thread
+inline void vTaskDelete(TaskHandle_t task)
+{
+    if (task && task != xTaskGetCurrentTaskHandle()) {
+        log_e("vTaskDelete of another task isn't supported on the host");
+        return;
+    }
+    throw HostTaskExit();
+}
+
+inline TickType_t xTaskGetTickCount() { return millis(); }
+inline void vTaskDelay(TickType_t ticks) { delay(ticks); }
+inline void vTaskDelayUntil(TickType_t* previousWake, TickType_t increment)
+{
+    *previousWake += increment;
+    int32_t wait = (int32_t)(*previousWake - xTaskGetTickCount());
+    if (wait > 0)
+        delay(wait);
+}
+inline BaseType_t xPortGetCoreID() { return xTaskGetCurrentTaskHandle()->coreId == 0 ? 0 : 1; }
+inline UBaseType_t uxTaskGetStackHighWaterMark(TaskHandle_t task) { return 1024; }
+inline UBaseType_t uxTaskGetNumberOfTasks()
+{
+    std::lock_guard<std::mutex> lock(host_tasks().mutex);
+    UBaseType_t count = 0;
+    for (HostTask* task : host_tasks().tasks)
+        count += !task->deleted;
+    return count;
+}
+inline TaskHandle_t xTaskGetHandle(const char* name)
+{
+    std::lock_guard<std::mutex> lock(host_tasks().mutex);
+    for (HostTask* task : host_tasks().tasks)
+        if (!task->deleted && task->name == name)
+            return task;
+    return nullptr;
+}
+
+// Run time counters are the CPU time of each thread in us, the total is the process CPU time
+inline uint32_t host_thread_cpu_us(pthread_t thread)
+{
+    clockid_t clock;
+    struct timespec ts;
+    if (pthread_getcpuclockid(thread, &clock) != 0 || clock_gettime(clock, &ts) != 0)
+        return 0;
+    return (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+inline UBaseType_t uxTaskGetSystemState(TaskStatus_t* status, UBaseType_t size, uint32_t* totalRunTime)
+{
+    std::lock_guard<std::mutex> lock(host_tasks().mutex);
+    UBaseType_t count = 0;
+    for (HostTask* task : host_tasks().tasks) {
+        if (task->deleted)
+            continue;
+        if (count == size)
+            return 0;
+        TaskStatus_t& s = status[count++];
+        s.xHandle = task;
+        s.pcTaskName = task->name.c_str();
+        s.xTaskNumber = task->number;
+        s.eCurrentState = task == host_current_task ? eRunning : eBlocked;
+        s.uxCurrentPriority = s.uxBasePriority = task->priority;
+        s.ulRunTimeCounter = host_thread_cpu_us(task->thread);
+        s.pxStackBase = nullptr;
+        s.usStackHighWaterMark = 1024;
+        s.xCoreID = task->coreId;
+    }
+    if (totalRunTime) {
+        struct timespec ts;
+        clock_gettime(CLOCK_PROCESS_CPUTIME_ID, &ts);
+        *totalRunTime = (uint64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+    }
+    return count;
+}
+inline void vTaskGetRunTimeStats(char* buffer)
+{
+    TaskStatus_t status[32];
+    uint32_t total;
+    UBaseType_t count = uxTaskGetSystemState(status, 32, &total);
+    buffer[0] = '\0';
+    for (UBaseType_t i = 0; i < count; i++)
+        buffer += sprintf(buffer, "%-16s%10u%5u%%\n", status[i].pcTaskName, status[i].ulRunTimeCounter,
+            total ? (unsigned)((uint64_t)status[i].ulRunTimeCounter * 100 / total) : 0);
+}
+
+inline uint32_t ulTaskNotifyTake(BaseType_t clearOnExit, TickType_t ticks)
+{
+    HostTask* task = xTaskGetCurrentTaskHandle();
+    std::unique_lock<std::mutex> lock(task->notifyMutex);
+    host_wait(task->notifyCv, lock, ticks, [task]() { return task->notifyValue != 0; });
+    uint32_t value = task->notifyValue;
+    if (value)
+        task->notifyValue = clearOnExit ? 0 : value - 1;
+    return value;
+}
+inline BaseType_t xTaskNotifyGive(TaskHandle_t task)
+{
+    std::lock_guard<std::mutex> lock(task->notifyMutex);
+    task->notifyValue++;
+    task->notifyCv.notify_all();
+    return pdPASS;
+}
+inline void vTaskNotifyGiveFromISR(TaskHandle_t task, BaseType_t* higherPriorityTaskWoken)
+{
+    xTaskNotifyGive(task);
+    if (higherPriorityTaskWoken)
+        *higherPriorityTaskWoken = pdFALSE;
+}
+
+// ---- Semaphores ----
+
+struct HostSemaphore
+{
+    std::mutex mutex;
+    std::condition_variable cv;
+    UBaseType_t count, max;
+    bool recursive = false;
+    HostTask* holder = nullptr; // Recursive mutex only
+    UBaseType_t depth = 0;
+};
+typedef HostSemaphore* SemaphoreHandle_t;
+
+inline SemaphoreHandle_t host_semaphore_create(UBaseType_t max, UBaseType_t initial)
+{
+    HostSemaphore* sem = new HostSemaphore();
+    sem->max = max;
+    sem->count = initial;
+    return sem;
+}
+inline SemaphoreHandle_t xSemaphoreCreateMutex() { return host_semaphore_create(1, 1); }
+inline SemaphoreHandle_t xSemaphoreCreateBinary() { return host_semaphore_create(1, 0); }
+inline SemaphoreHandle_t xSemaphoreCreateCounting(UBaseType_t max, UBaseType_t initial) { return host_semaphore_create(max, initial); }
+inline SemaphoreHandle_t xSemaphoreCreateRecursiveMutex()
+{
+    SemaphoreHandle_t sem = host_semaphore_create(1, 1);
+    sem->recursive = true;
+    return sem;
+}
+inline void vSemaphoreDelete(SemaphoreHandle_t sem) { delete sem; }
+
+inline BaseType_t xSemaphoreTake(SemaphoreHandle_t sem, TickType_t ticks)
+{
+    std::unique_lock<std::mutex> lock(sem->mutex);
+    if (!host_wait(sem->cv, lock, ticks, [sem]() { return sem->count > 0; }))
+        return pdFALSE;
+    sem->count--;
+    return pdTRUE;
+}
+inline BaseType_t xSemaphoreGive(SemaphoreHandle_t sem)
+{
+    std::lock_guard<std::mutex> lock(sem->mutex);
+    if (sem->count == sem->max)
+        return pdFALSE;
+    sem->count++;
+    sem->cv.notify_one();
+    return pdTRUE;
+}
+inline BaseType_t xSemaphoreGiveFromISR(SemaphoreHandle_t sem, BaseType_t* higherPriorityTaskWoken)
+{
+    if (higherPriorityTaskWoken)
+        *higherPriorityTaskWoken = pdFALSE;
+    return xSemaphoreGive(sem);
+}
+inline BaseType_t xSemaphoreTakeRecursive(SemaphoreHandle_t sem, TickType_t ticks)
+{
+    HostTask* self = xTaskGetCurrentTaskHandle();
+    std::unique_lock<std::mutex> lock(sem->mutex);
+    if (sem->holder != self) {
+        if (!host_wait(sem->cv, lock, ticks, [sem]() { return sem->holder == nullptr; }))
+            return pdFALSE;
+        sem->holder = self;
+    }
+    sem->depth++;
+    return pdTRUE;
+}
+inline BaseType_t xSemaphoreGiveRecursive(SemaphoreHandle_t sem)
+{
+    std::lock_guard<std::mutex> lock(sem->mutex);
+    if (sem->holder != xTaskGetCurrentTaskHandle())
+        return pdFALSE;
+    if (--sem->depth == 0) {
+        sem->holder = nullptr;
+        sem->cv.notify_one();
+    }
+    return pdTRUE;
+}
+
+// ---- Queues ----
+
+struct HostQueue
+{
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::deque<std::vector<uint8_t>> items;
+    UBaseType_t length, itemSize;
+};
+typedef HostQueue* QueueHandle_t;
+
+inline QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t itemSize)
+{
+    HostQueue* queue = new HostQueue();
+    queue->length = length;
+    queue->itemSize = itemSize;
+    return queue;
+}
+inline void vQueueDelete(QueueHandle_t queue) { delete queue; }
+
+inline BaseType_t xQueueSend(QueueHandle_t queue, const void* item, TickType_t ticks)
+{
+    std::unique_lock<std::mutex> lock(queue->mutex);
+    if (!host_wait(queue->cv, lock, ticks, [queue]() { return queue->items.size() < queue->length; }))
+        return errQUEUE_FULL;
+    queue->items.emplace_back((const uint8_t*)item, (const uint8_t*)item + queue->itemSize);
+    queue->cv.notify_all();
+    return pdPASS;
+}
+#define xQueueSendToBack xQueueSend
+inline BaseType_t xQueueSendFromISR(QueueHandle_t queue, const void* item, BaseType_t* higherPriorityTaskWoken)
+{
+    if (higherPriorityTaskWoken)
+        *higherPriorityTaskWoken = pdFALSE;
+    return xQueueSend(queue, item, 0);
+}
+inline BaseType_t xQueueReceive(QueueHandle_t queue, void* item, TickType_t ticks)
+{
+    std::unique_lock<std::mutex> lock(queue->mutex);
+    if (!host_wait(queue->cv, lock, ticks, [queue]() { return !queue->items.empty(); }))
+        return pdFALSE;
+    memcpy(item, queue->items.front().data(), queue->itemSize);
+    queue->items.pop_front();
+    queue->cv.notify_all();
+    return pdTRUE;
+}
+inline UBaseType_t uxQueueMessagesWaiting(QueueHandle_t queue)
+{
+    std::lock_guard<std::mutex> lock(queue->mutex);
+    return queue->items.size();
+}
@@ -0,0 +1,82 @@
+#pragma once
+// Fakes of the I2C chips of the board for the host build of the firmware, attached to Wire by host_main.cpp
+#include <Wire.h>
+#include <time.h>
+
+// DS3231 RTC : the time registers follow the host local time, setting them keep the offset to it like the battery
+// backed chip keep its own time. Oscillator never stopped so lostPower() is false
+class HostDS3231 : public TwoWireDevice
+{
+    uint8_t regs[0x13] = {};
+    uint8_t pointer = 0;
+    time_t offset = 0;
+
+    static uint8_t bin2bcd(uint8_t val) { return val + 6 * (val / 10); }
+    static uint8_t bcd2bin(uint8_t val) { return val - 6 * (val >> 4); }
+
+    void latchTime()
+    {
+        time_t t = time(NULL) + offset;
+        struct tm tm;
+        localtime_r(&t, &tm);
+        regs[0] = bin2bcd(tm.tm_sec);
+        regs[1] = bin2bcd(tm.tm_min);
+        regs[2] = bin2bcd(tm.tm_hour);
+        regs[3] = bin2bcd(tm.tm_wday ? tm.tm_wday : 7);
+        regs[4] = bin2bcd(tm.tm_mday);
+        regs[5] = bin2bcd(tm.tm_mon + 1);
+        regs[6] = bin2bcd(tm.tm_year - 100);
+    }
+    void storeTime()
+    {
+        struct tm tm = {};
+        tm.tm_sec = bcd2bin(regs[0] & 0x7F);
+        tm.tm_min = bcd2bin(regs[1]);
+        tm.tm_hour = bcd2bin(regs[2] & 0x3F);
+        tm.tm_mday = bcd2bin(regs[4]);
+        tm.tm_mon = bcd2bin(regs[5] & 0x7F) - 1;
+        tm.tm_year = bcd2bin(regs[6]) + 100;
+        tm.tm_isdst = -1;
+        offset = mktime(&tm) - time(NULL);
+    }
+
+public:
+    HostDS3231() { regs[0x0E] = 0x1C; }
+
+    void receive(const uint8_t* data, size_t len)
+    {
+        if (!len)
+            return;
+        pointer = data[0];
+        if (len == 1)
+            return;
+        bool timeWritten = false;
+        latchTime();
+        for (size_t i = 1; i < len; i++, pointer = (pointer + 1) % sizeof(regs)) {
+            regs[pointer] = data[i];
+            timeWritten |= pointer <= 6;
+        }
+        if (timeWritten)
+            storeTime();
+    }
+    void request(uint8_t* data, size_t len)
+    {
+        latchTime();
+        for (size_t i = 0; i < len; i++, pointer = (pointer + 1) % sizeof(regs))
+            data[i] = regs[pointer];
+    }
+};
+
+// PCF8574 expander : quasi-bidirectional pins read back the latch, nothing pulls an input low
+class HostPCF8574 : public TwoWireDevice
+{
+    uint8_t latch = 0xFF;
+
+public:
+    void receive(const uint8_t* data, size_t len)
+    {
+        if (len)
+            latch = data[len - 1];
+    }
+    void request(uint8_t* data, size_t len) { memset(data, latch, len); }
+};
@@ -0,0 +1,68 @@
+#pragma once
+// Display of the host build : the LovyanGFX Linux framebuffer panel drawing in memory instead of /dev/fb0, same
+// 480x320 landscape and 24 bit color as the ILI9488 of the board. No touch controller, lgfx_init() fall back to polling
+#define LGFX_USE_V1
+#include <LovyanGFX.hpp>
+#include <lgfx/v1/platforms/framebuffer/Panel_fb.hpp>
+
+class Panel_HostFb : public lgfx::Panel_fb
+{
+public:
+    Panel_HostFb()
+    {
+        auto cfg = config();
+        cfg.memory_width = cfg.panel_width = 480;
+        cfg.memory_height = cfg.panel_height = 320;
+        cfg.offset_rotation = 0;
+        config(cfg);
+    }
+    ~Panel_HostFb()
+    {
+        free(_fbp);
+        _fbp = nullptr;
+    }
+
+    bool init(bool use_reset) override
+    {
+        if (!_fbp) {
+            memset(&_var_info, 0, sizeof(_var_info));
+            memset(&_fix_info, 0, sizeof(_fix_info));
+            _var_info.xres = _var_info.xres_virtual = _cfg.panel_width;
+            _var_info.yres = _var_info.yres_virtual = _cfg.panel_height;
+            _var_info.bits_per_pixel = 24;
+            _fix_info.line_length = _cfg.panel_width * 3;
+            _screensize = _fix_info.smem_len = _fix_info.line_length * _cfg.panel_height;
+            _fbp = (char*)calloc(1, _screensize);
+            if (!_fbp)
+                return false;
+        }
+        setColorDepth(lgfx::color_depth_t::rgb888_3Byte);
+        return Panel_Device::init(use_reset);
+    }
+
+    // Dump the framebuffer as a binary PPM, it is already RGB in memory order
+    bool savePpm(const char* path)
+    {
+        FILE* fp = fopen(path, "wb");
+        if (!fp)
+            return false;
+        fprintf(fp, "P6\n%u %u\n255\n", _var_info.xres, _var_info.yres);
+        bool ok = fwrite(_fbp, 1, _screensize, fp) == (size_t)_screensize;
+        return fclose(fp) == 0 && ok;
+    }
+};
+
+class LGFX : public lgfx::LGFX_Device
+{
+    Panel_HostFb _panel_instance;
+    lgfx::Bus_NULL _bus_instance;
+
+public:
+    LGFX(void)
+    {
+        _panel_instance.setBus(&_bus_instance);
+        setPanel(&_panel_instance);
+    }
+
+    bool savePpm(const char* path) { return _panel_instance.savePpm(path); }
+};
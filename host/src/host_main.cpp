@@ -0,0 +1,92 @@
+// Host build of the firmware (env:native_ui) : the real setup()/loop() of src/main.cpp on the fakes of host/include.
+// The SD card is a directory, the RTC and IO expander are fakes on Wire, audio is paced by the MP3 bitrate and
+// muted, and the display is the LovyanGFX framebuffer panel in memory. Serial commands are read from stdin.
+//
+//   program [--sd DIR] [--bench] [--shot FILE.ppm]
+//
+// --sd DIR        Directory used as the SD card, default host_sd
+// --bench         Run "uibench" once the UI is up, then exit
+// --shot FILE     Save the display as PPM after the benchmark, or once stdin is closed
+#include <Arduino.h>
+#include <SD.h>
+#include <host_devices.h>
+#include <lgfx_host.h>
+#include <atomic>
+#include <thread>
+
+#define HOST_RTC_ADDRESS 0x68
+#define HOST_EXPANDER_ADDRESS 0x20 // IOEXPAND_I2C_ADDRESS
+#define HOST_SETTLE_TIME 1000 // ms left to LVGL to redraw after the last command or the benchmark, before the screenshot
+
+void setup(void);
+void loop();
+extern LGFX tft;
+
+static HostDS3231 hostRtc;
+static HostPCF8574 hostExpander;
+static std::atomic<bool> stdinClosed(false);
+
+// Feed stdin to Serial line by line with the CR LF of a serial terminal
+static void stdin_reader()
+{
+    char line[128];
+    while (fgets(line, sizeof(line) - 2, stdin)) {
+        line[strcspn(line, "\r\n")] = '\0';
+        strcat(line, "\r\n");
+        Serial.feed(line);
+    }
+    stdinClosed = true;
+}
+
+static void host_exit(const char* shot)
+{
+    if (shot) {
+        if (tft.savePpm(shot))
+            log_i("Display saved to %s", shot);
+        else
+            log_e("Can't write %s", shot);
+    }
+    fflush(stdout);
+    fflush(stderr);
+    _Exit(0); // The firmware tasks never return, don't run destructors under them
+}
+
+int main(int argc, char** argv)
+{
+    const char* shot = NULL;
+    bool bench = false;
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], "--sd") == 0 && i + 1 < argc)
+            SD.hostRoot(argv[++i]);
+        else if (strcmp(argv[i], "--bench") == 0)
+            bench = true;
+        else if (strcmp(argv[i], "--shot") == 0 && i + 1 < argc)
+            shot = argv[++i];
+        else {
+            fprintf(stderr, "usage: %s [--sd DIR] [--bench] [--shot FILE.ppm]\n", argv[0]);
+            return 2;
+        }
+    }
+    setvbuf(stdout, NULL, _IOLBF, 0);
+
+    Wire.attach(HOST_RTC_ADDRESS, &hostRtc);
+    Wire.attach(HOST_EXPANDER_ADDRESS, &hostExpander);
+
+    setup();
+    if (bench) {
+        Serial.feed("uibench\r\n");
+        loop(); // ui_benchmark() run inside this loop()
+        delay(HOST_SETTLE_TIME);
+        host_exit(shot);
+    }
+
+    std::thread(stdin_reader).detach();
+    uint32_t idleStart = millis();
+    for (;;) {
+        loop();
+        if (!stdinClosed || Serial.available())
+            idleStart = millis();
+        else if (millis() - idleStart >= HOST_SETTLE_TIME)
+            host_exit(shot);
+    }
+}
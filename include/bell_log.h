@@ -0,0 +1,234 @@
+#pragma once
+#include <Arduino.h>
+#include <FS.h>
+#include <RTClib.h>
+
+/*
+Append-only history of every bell, one file per day named YYYYMMDD.bin on the log folder :
+  BellLogHeader, then BellLogRecord until the end of the file (little endian, packed)
+A record is completed when its audio ends, is cut by another bell or fails, and is kept on RAM until the next
+loop() flush, so the scheduler and audio task never wait for SD. Read the files with tools/bell_log_report.py
+*/
+
+#define BELLOG_MAGIC 0x4C4C4542 // "BELL"
+#define BELLOG_VERSION 1
+#define BELLOG_BUFFER_LEN 32 // Completed records waiting for loop(), more are dropped and counted
+#define BELLOG_FLUSH_PERIOD 60000 // ms
+#define BELLOG_KEEP_DAYS 90 // Older day files are removed on rotation
+#define BELLOG_MANUAL 0xFFFF // BellLogRecord::scheduled of a manual bell
+#define BELLOG_NO_AUDIO 0xFFFF // BellLogRecord::latencyMs when the audio never started
+#define BELLOG_FILE_LEN 32
+
+enum BellLogFlag : uint16_t
+{
+    BELLOG_PREEMPTED = 1 << 0, // Cut by the next bell, before or while playing
+    BELLOG_PREEMPTS = 1 << 1, // Started by stopping the audio of the previous bell
+    BELLOG_ERR_NOT_MP3 = 1 << 2,
+    BELLOG_ERR_BEGIN = 1 << 3, // MP3 decoder couldn't start, missing or broken file
+};
+
+struct __attribute__((packed)) BellLogHeader
+{
+    uint32_t magic;
+    uint16_t version;
+    uint16_t recordSize;
+};
+
+struct __attribute__((packed)) BellLogRecord
+{
+    uint32_t trigger; // Unix time the relay was turned on
+    uint16_t triggerMs;
+    uint16_t scheduled; // HHMM of the jadwal, or BELLOG_MANUAL
+    uint16_t latencyMs; // Trigger to audio start
+    uint16_t flags; // BellLogFlag
+    uint32_t durationMs; // Audio start to stop
+    uint8_t index; // Bell index on the day jadwal or on belManual
+    uint8_t reserved[3];
+    char file[BELLOG_FILE_LEN]; // Audio path, the end is kept when too long
+};
+
+class BellLog
+{
+    struct Open
+    {
+        bool open;
+        uint32_t millis; // Trigger, then audio start
+        BellLogRecord rec;
+    } pending = {}, playing = {}; // Triggered and waiting for audio, audio playing
+    BellLogRecord buffer[BELLOG_BUFFER_LEN];
+    uint8_t count = 0;
+    uint32_t lastFlush = 0;
+    portMUX_TYPE mux = portMUX_INITIALIZER_UNLOCKED;
+    uint32_t lastDay = 0;
+    bool failed = false; // Last flush didn't write everything, wait BELLOG_FLUSH_PERIOD before the next
+    uint16_t tornBytes = 0; // Start of buffer[0] already on its file after a short write
+
+    void close(Open& o)
+    {
+        if (!o.open)
+            return;
+        o.open = false;
+        if (count < BELLOG_BUFFER_LEN)
+            buffer[count++] = o.rec;
+        else
+            dropped++;
+    }
+
+    static uint32_t dayOf(uint32_t unixtime) { return unixtime / 86400; }
+
+    static void path(char* out, const char* dir, uint32_t unixtime)
+    {
+        DateTime t(unixtime);
+        sprintf(out, "%s%04d%02d%02d.bin", dir, t.year(), t.month(), t.day());
+    }
+
+    // Keep the newest BELLOG_KEEP_DAYS files, names sort by date
+    void rotate(fs::FS& fs, const char* dir)
+    {
+        File root = fs.open(dir);
+        if (!root || !root.isDirectory())
+            return;
+        char oldest[BELLOG_FILE_LEN] = { 0 };
+        uint16_t files = 0;
+        for (File file = root.openNextFile(); file; file = root.openNextFile()) {
+            const char* name = strrchr(file.name(), '/') ? strrchr(file.name(), '/') + 1 : file.name();
+            files++;
+            if (!oldest[0] || strcmp(name, oldest) < 0)
+                strncpy(oldest, name, sizeof(oldest) - 1);
+        }
+        root.close();
+        if (files > BELLOG_KEEP_DAYS) {
+            char oldPath[64];
+            snprintf(oldPath, sizeof(oldPath), "%s%s", dir, oldest);
+            fs.remove(oldPath);
+            log_d("Bell log %s removed", oldPath);
+        }
+    }
+
+public:
+    uint32_t written = 0, dropped = 0, writeErrors = 0;
+
+    // Relay turned on for a bell, at unix time nowMs
+    void trigger(int64_t nowMs, uint16_t scheduled, uint8_t index, const char* file)
+    {
+        portENTER_CRITICAL(&mux);
+        if (pending.open) { // Previous bell never reached its audio
+            pending.rec.flags |= BELLOG_PREEMPTED;
+            close(pending);
+        }
+        pending.open = true;
+        pending.millis = millis();
+        memset(&pending.rec, 0, sizeof(pending.rec));
+        pending.rec.trigger = nowMs / 1000;
+        pending.rec.triggerMs = nowMs % 1000;
+        pending.rec.scheduled = scheduled;
+        pending.rec.latencyMs = BELLOG_NO_AUDIO;
+        pending.rec.index = index;
+        size_t len = strlen(file);
+        strncpy(pending.rec.file, len < BELLOG_FILE_LEN ? file : file + len - (BELLOG_FILE_LEN - 1), BELLOG_FILE_LEN - 1);
+        portEXIT_CRITICAL(&mux);
+    }
+
+    // Audio task tried to start the audio, errorFlag is 0 or BELLOG_ERR_*, preempts when a playing audio was stopped
+    void audioStart(uint16_t errorFlag, bool preempts)
+    {
+        portENTER_CRITICAL(&mux);
+        uint32_t now = millis();
+        if (playing.open && preempts) {
+            playing.rec.flags |= BELLOG_PREEMPTED;
+            playing.rec.durationMs = now - playing.millis;
+            close(playing);
+        }
+        if (pending.open) {
+            pending.rec.flags |= errorFlag | (preempts ? BELLOG_PREEMPTS : 0);
+            if (errorFlag)
+                close(pending);
+            else {
+                pending.rec.latencyMs = now - pending.millis;
+                close(playing); // Not expected, the previous audio ended without audioEnd()
+                playing = pending;
+                playing.millis = now;
+                pending.open = false;
+            }
+        }
+        portEXIT_CRITICAL(&mux);
+    }
+
+    void audioEnd()
+    {
+        portENTER_CRITICAL(&mux);
+        if (playing.open) {
+            playing.rec.durationMs = millis() - playing.millis;
+            close(playing);
+        }
+        portEXIT_CRITICAL(&mux);
+    }
+
+    // Append the completed records to their day file, every BELLOG_FLUSH_PERIOD, when the buffer is half full
+    // or when forced (before restart). Call from a task that can wait for SD. Records stay on the buffer until
+    // they are completely written, after a failure they are retried on the next period
+    void loop(fs::FS& fs, const char* dir, bool force = false)
+    {
+        if (!force && millis() - lastFlush < BELLOG_FLUSH_PERIOD && (failed || count < BELLOG_BUFFER_LEN / 2))
+            return;
+        lastFlush = millis();
+        BellLogRecord records[BELLOG_BUFFER_LEN];
+        portENTER_CRITICAL(&mux);
+        uint8_t n = count;
+        memcpy(records, buffer, n * sizeof(BellLogRecord));
+        portEXIT_CRITICAL(&mux);
+        if (n == 0)
+            return;
+        if (!fs.exists(dir))
+            fs.mkdir(dir);
+        uint8_t done = 0; // Records completely on SD
+        failed = false;
+        while (done < n) { // Records of the same day go with one open
+            char filePath[64];
+            path(filePath, dir, records[done].trigger);
+            File file = fs.open(filePath, FILE_APPEND);
+            if (!file) {
+                log_e("Can't open %s", filePath);
+                failed = true;
+                break;
+            }
+            if (file.size() == 0) {
+                BellLogHeader header = { BELLOG_MAGIC, BELLOG_VERSION, sizeof(BellLogRecord) };
+                tornBytes = 0;
+                if (file.write((uint8_t*)&header, sizeof(header)) != sizeof(header)) {
+                    file.close();
+                    log_e("Can't write %s", filePath);
+                    failed = true;
+                    break;
+                }
+            }
+            uint32_t day = dayOf(records[done].trigger);
+            uint8_t last = done;
+            while (last < n && dayOf(records[last].trigger) == day)
+                last++;
+            // A short write left the start of records[done] on the file, continue it to keep the records aligned
+            size_t len = (last - done) * sizeof(BellLogRecord);
+            size_t end = tornBytes + file.write((uint8_t*)&records[done] + tornBytes, len - tornBytes);
+            file.close();
+            written += end / sizeof(BellLogRecord);
+            done += end / sizeof(BellLogRecord);
+            tornBytes = end % sizeof(BellLogRecord);
+            if (end < len) {
+                log_e("Short write on %s, %u records left", filePath, n - done);
+                failed = true;
+                break;
+            }
+            if (day != lastDay) {
+                lastDay = day;
+                rotate(fs, dir);
+            }
+        }
+        if (failed)
+            writeErrors++;
+        // Records completed since the copy stay after the unwritten ones
+        portENTER_CRITICAL(&mux);
+        count -= done;
+        memmove(buffer, buffer + done, count * sizeof(BellLogRecord));
+        portEXIT_CRITICAL(&mux);
+    }
+};
@@ -0,0 +1,112 @@
+#pragma once
+#include <Arduino.h>
+#include <RTClib.h>
+#include <plc_timer.h>
+
+#define BELL_NONE 255 // nextIndex when there is no bell left for today
+#define BELL_AUDIO_DELAY 2000 // Relay settle time before audio start, and relay hold time after audio stop (ms)
+#define BELL_FILE_LEN 128 // Same as JadwalHari::belAudioFile
+
+// Hardware side of the bell. The device drive the IO expander and audio task, the host simulator
+// (test/test_bell_sim) log the events.
+// lock() and unlock() surround the calls that must be atomic against the audio task
+class BellOutput
+{
+public:
+    virtual void lock() {}
+    virtual void unlock() {}
+    virtual void relay(bool on) = 0;
+    virtual void playAudio(const char* file) = 0; // Start file right away
+    virtual bool audioPlaying() = 0;
+    virtual bool audioStopped() = 0; // Audio has ended but the relay is still held on
+    virtual void clearAudioStopped() = 0;
+};
+
+// Bell evaluation of one day. Wall clock time is given by the caller and the delay timers run on the Stopwatch
+// clock, so the same code runs against the RTC on the device and against a virtual clock in the simulator
+class BellScheduler
+{
+    BellOutput& out;
+    TON delayStart, delayStop;
+    bool preAudioPlay = false; // Relay is on, audio waits for delayStart
+    bool playedFlag = false; // A bell already rang at playedTime
+    uint16_t playedTime = 0; // HHMM
+    char audioFile[BELL_FILE_LEN] = { 0 };
+
+public:
+    uint8_t nextIndex = BELL_NONE;
+
+    BellScheduler(BellOutput& output, Stopwatch::Clock clock = Stopwatch::defaultClock)
+        : out(output), delayStart(BELL_AUDIO_DELAY, clock), delayStop(BELL_AUDIO_DELAY, clock) {}
+
+    // Turn on the relay and play file, after the relay settle time unless the audio path is already active
+    void ring(const char* file)
+    {
+        out.relay(true);
+        out.lock();
+        strncpy(audioFile, file, sizeof(audioFile) - 1);
+        if (out.audioPlaying() || out.audioStopped()) { // Relay is already on, play right away
+            out.clearAudioStopped();
+            out.playAudio(audioFile);
+        }
+        else
+            preAudioPlay = true;
+        out.unlock();
+    }
+
+    // Check the bells of jw (JadwalHari) against tbel (HHMM), call it every second.
+    // Return the index of the bell that rang, or -1
+    template <typename Jadwal>
+    int check(const Jadwal& jw, uint16_t tbel)
+    {
+        int rang = -1;
+        // Reset the flag once the minute of the played bell is over, before the check so a 23:59 bell doesn't
+        // hold back a 00:00 bell, and also after a jadwal reload
+        if (playedFlag && tbel != playedTime) {
+            playedFlag = false;
+            log_d("Bell reset!");
+        }
+        for (int i = 0; i < jw.jumlahBel; i++) {
+            if (tbel == jw.jadwalBel[i] && !playedFlag) { // Ring the audio bell once!
+                playedFlag = true;
+                playedTime = tbel;
+                ring(jw.belAudioFile[i]);
+                rang = i;
+            }
+            if (tbel < jw.jadwalBel[i]) {
+                nextIndex = i;
+                break;
+            }
+            if (i == jw.jumlahBel - 1 && tbel >= jw.jadwalBel[i]) {
+                nextIndex = BELL_NONE;
+                break;
+            }
+        }
+        if (jw.jumlahBel == 0)
+            nextIndex = BELL_NONE;
+        return rang;
+    }
+
+    // Run the relay and audio delay timers, call it every scheduler tick
+    void update()
+    {
+        delayStart.IN(preAudioPlay);
+        out.lock();
+        delayStop.IN(out.audioStopped());
+        out.unlock();
+        if (delayStart.Q()) {
+            preAudioPlay = false;
+            out.lock();
+            out.playAudio(audioFile);
+            out.unlock();
+        }
+        if (delayStop.Q()) { // Turn off relay BELL_AUDIO_DELAY after the audio stopped
+            out.lock();
+            out.clearAudioStopped();
+            out.unlock();
+            out.relay(false);
+        }
+    }
+
+    bool pending() { return preAudioPlay; }
+};
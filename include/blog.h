@@ -0,0 +1,230 @@
+#pragma once
+#include <Arduino.h>
+
+/*
+Binary log ring. A log call only store the format pointer, timestamp and raw arguments, the text is formatted
+later by the drain task, so a debug line cost a few microseconds instead of waiting for the UART at 115200.
+Strings are copied into the entry because callers often pass stack buffers, each %s of a line get an equal share
+of BLOG_TEXT_LEN and a cut string end with "..". Arguments past BLOG_MAX_SLOTS print as "?".
+When the ring is full new lines are dropped and counted, log calls never block.
+With BLOG_CAPTURE_LOG, log_i/log_d/log_v go through the ring. log_w and log_e are still printed right away
+so errors are not lost on a crash.
+*/
+
+#define BLOG_CAPTURE_LOG 1
+#define BLOG_LEN 128 // Entries, power of 2
+#define BLOG_MAX_SLOTS 8 // 32 bit argument slots per entry, 64 bit values take two, strings take none
+#define BLOG_TEXT_LEN 96 // Shared by the strings of a line, BLOG_TEXT_LEN / strings each (terminator included)
+#define BLOG_LINE_LEN 256
+#define BLOG_DRAIN_PERIOD 20 // ms
+
+struct BlogEntry
+{
+    uint32_t us;
+    const char* fmt; // String literal, also work as the format id
+    const char* file; // __FILE__ and __FUNCTION__ of the call, literals too
+    const char* func;
+    uint16_t line;
+    char level;
+    uint8_t slots;
+    uint8_t textLen;
+    uint8_t textMax; // Budget of each string
+    uint32_t args[BLOG_MAX_SLOTS];
+    char text[BLOG_TEXT_LEN];
+};
+
+namespace Blog
+{
+    static BlogEntry ring[BLOG_LEN];
+    static uint16_t head, tail; // Next entry to write and to drain, free running
+    static uint32_t written, dropped;
+    static portMUX_TYPE mux = portMUX_INITIALIZER_UNLOCKED;
+
+    inline void pack32(BlogEntry& e, uint32_t v)
+    {
+        if (e.slots < BLOG_MAX_SLOTS)
+            e.args[e.slots++] = v;
+    }
+    inline void pack64(BlogEntry& e, uint64_t v)
+    {
+        pack32(e, (uint32_t)v);
+        pack32(e, (uint32_t)(v >> 32));
+    }
+    // Strings are stored one after the other in text, in the order of their %s
+    inline void pack(BlogEntry& e, const char* s)
+    {
+        if (!s)
+            s = "(null)";
+        uint8_t max = BLOG_TEXT_LEN - e.textLen < e.textMax ? BLOG_TEXT_LEN - e.textLen : e.textMax;
+        if (max == 0) // Printed as "?"
+            return;
+        char* out = e.text + e.textLen;
+        uint8_t len = 0;
+        for (; s[len] && len < max - 1; len++)
+            out[len] = s[len];
+        if (s[len] && len >= 2) // Cut
+            out[len - 1] = out[len - 2] = '.';
+        out[len] = 0;
+        e.textLen += len + 1;
+    }
+    inline void pack(BlogEntry& e, char* s) { pack(e, (const char*)s); }
+    inline void pack(BlogEntry& e, double v)
+    {
+        uint64_t raw;
+        memcpy(&raw, &v, sizeof(raw));
+        pack64(e, raw);
+    }
+    inline void pack(BlogEntry& e, float v) { pack(e, (double)v); }
+    template <typename T>
+    inline void pack(BlogEntry& e, T* p) { pack32(e, (uint32_t)(uintptr_t)p); }
+    template <typename T>
+    inline void pack(BlogEntry& e, T v)
+    {
+        if (sizeof(T) > 4)
+            pack64(e, (uint64_t)v);
+        else
+            pack32(e, (uint32_t)v);
+    }
+
+    template <typename T>
+    struct IsText { static const uint8_t value = 0; };
+    template <>
+    struct IsText<const char*> { static const uint8_t value = 1; };
+    template <>
+    struct IsText<char*> { static const uint8_t value = 1; };
+    template <typename... Args>
+    struct TextCount { static const uint8_t value = 0; };
+    template <typename T, typename... Rest>
+    struct TextCount<T, Rest...> { static const uint8_t value = IsText<T>::value + TextCount<Rest...>::value; };
+
+    template <typename... Args>
+    inline void write(char level, const char* file, uint16_t line, const char* func, const char* fmt, Args... args)
+    {
+        BlogEntry e;
+        e.us = micros();
+        e.fmt = fmt;
+        e.file = file;
+        e.func = func;
+        e.line = line;
+        e.level = level;
+        e.slots = 0;
+        e.textLen = 0;
+        e.textMax = BLOG_TEXT_LEN / (TextCount<Args...>::value ? TextCount<Args...>::value : 1);
+        int expand[] = { 0, (pack(e, args), 0)... };
+        (void)expand;
+        portENTER_CRITICAL_SAFE(&mux);
+        if ((uint16_t)(head - tail) >= BLOG_LEN)
+            dropped++;
+        else {
+            ring[head % BLOG_LEN] = e;
+            head++;
+            written++;
+        }
+        portEXIT_CRITICAL_SAFE(&mux);
+    }
+
+    inline uint16_t pending() { return head - tail; }
+
+    // Format e into line (BLOG_LINE_LEN) the way printf would have, one conversion at a time from the stored slots.
+    // Same prefix as the Arduino log_x
+    inline size_t format(const BlogEntry& e, char* line)
+    {
+        const char* file = strrchr(e.file, '/') ? strrchr(e.file, '/') + 1 : e.file;
+        size_t n = snprintf(line, BLOG_LINE_LEN, "[%6lu][%c][%s:%u] %s(): ", e.us / 1000, e.level, file, e.line, e.func);
+        if (n > BLOG_LINE_LEN - 1)
+            n = BLOG_LINE_LEN - 1;
+        uint8_t slot = 0, textPos = 0;
+        const char* p = e.fmt;
+        while (*p && n < BLOG_LINE_LEN - 1) {
+            if (*p != '%' || p[1] == '%') {
+                line[n++] = *p;
+                p += *p == '%' ? 2 : 1;
+                continue;
+            }
+            char spec[16];
+            uint8_t len = 0, longs = 0;
+            spec[len++] = *p++;
+            while (*p && strchr("-+ #0123456789.", *p) && len < 10)
+                spec[len++] = *p++;
+            while (*p && strchr("hlLqjzt", *p) && len < 13) {
+                longs += *p == 'l' || *p == 'q' || *p == 'j';
+                spec[len++] = *p++;
+            }
+            char conv = *p ? *p++ : 's';
+            spec[len++] = conv;
+            spec[len] = 0;
+            char* out = line + n;
+            size_t room = BLOG_LINE_LEN - n;
+            int added;
+            uint8_t need = conv == 's' ? 0 : strchr("fFeEgGaA", conv) || longs >= 2 ? 2 : 1;
+            if (conv == 's' ? textPos >= e.textLen : slot + need > e.slots) // Past BLOG_MAX_SLOTS
+                added = snprintf(out, room, "?");
+            else if (conv == 's') {
+                added = snprintf(out, room, spec, e.text + textPos);
+                textPos += strlen(e.text + textPos) + 1;
+            }
+            else if (need == 2) {
+                uint64_t raw = e.args[slot] | (uint64_t)e.args[slot + 1] << 32;
+                if (longs >= 2)
+                    added = snprintf(out, room, spec, raw);
+                else {
+                    double v;
+                    memcpy(&v, &raw, sizeof(v));
+                    added = snprintf(out, room, spec, v);
+                }
+            }
+            else if (conv == 'p')
+                added = snprintf(out, room, spec, (void*)(uintptr_t)e.args[slot]);
+            else
+                added = snprintf(out, room, spec, e.args[slot]);
+            slot += need;
+            n += added < 0 ? 0 : added;
+        }
+        if (n > BLOG_LINE_LEN - 2)
+            n = BLOG_LINE_LEN - 2;
+        line[n++] = '\n';
+        return n;
+    }
+
+    // Print every pending entry, called by the drain task and before restart
+    inline void flush()
+    {
+        BlogEntry e;
+        char line[BLOG_LINE_LEN];
+        for (;;) {
+            portENTER_CRITICAL(&mux);
+            bool empty = head == tail;
+            if (!empty)
+                e = ring[tail++ % BLOG_LEN];
+            portEXIT_CRITICAL(&mux);
+            if (empty)
+                return;
+            Serial.write((const uint8_t*)line, format(e, line));
+        }
+    }
+
+    inline void begin(BaseType_t core)
+    {
+        xTaskCreatePinnedToCore([](void*) {
+            for (;;) {
+                flush();
+                vTaskDelay(pdMS_TO_TICKS(BLOG_DRAIN_PERIOD));
+            }
+            }, "logTask", 3072, NULL, tskIDLE_PRIORITY + 1, NULL, core);
+    }
+}
+
+#if BLOG_CAPTURE_LOG
+#if ARDUHAL_LOG_LEVEL >= ARDUHAL_LOG_LEVEL_INFO
+#undef log_i
+#define log_i(format, ...) Blog::write('I', __FILE__, __LINE__, __FUNCTION__, format, ##__VA_ARGS__)
+#endif
+#if ARDUHAL_LOG_LEVEL >= ARDUHAL_LOG_LEVEL_DEBUG
+#undef log_d
+#define log_d(format, ...) Blog::write('D', __FILE__, __LINE__, __FUNCTION__, format, ##__VA_ARGS__)
+#endif
+#if ARDUHAL_LOG_LEVEL >= ARDUHAL_LOG_LEVEL_VERBOSE
+#undef log_v
+#define log_v(format, ...) Blog::write('V', __FILE__, __LINE__, __FUNCTION__, format, ##__VA_ARGS__)
+#endif
+#endif
@@ -0,0 +1,40 @@
+#pragma once
+#include <Arduino.h>
+
+#define BOOT_MARKS_LEN 24
+
+// Timestamp of the end of each boot phase, marked from setup() and the boot task on the other core.
+// Printed once the first frame is on the display and again with "boot"
+struct BootMark
+{
+    const char* name; // Kept as pointer, must be a string literal
+    uint32_t us; // Since app start, the bootloader time before it isn't counted
+    uint8_t core;
+};
+static BootMark bootMarks[BOOT_MARKS_LEN];
+static uint8_t bootMarkCount;
+static portMUX_TYPE bootMarkMux = portMUX_INITIALIZER_UNLOCKED;
+
+inline void boot_mark(const char* name)
+{
+    uint32_t us = micros();
+    portENTER_CRITICAL(&bootMarkMux);
+    if (bootMarkCount < BOOT_MARKS_LEN)
+        bootMarks[bootMarkCount++] = { name, us, (uint8_t)xPortGetCoreID() };
+    portEXIT_CRITICAL(&bootMarkMux);
+}
+
+// Each phase with its duration, measured from the previous mark on the same core
+inline void boot_profile_dump()
+{
+    Serial.println("Boot profile :\n  time (ms)  phase (ms) core  phase");
+    for (uint8_t i = 0; i < bootMarkCount; i++) {
+        uint32_t from = 0;
+        for (int8_t j = i - 1; j >= 0; j--)
+            if (bootMarks[j].core == bootMarks[i].core) {
+                from = bootMarks[j].us;
+                break;
+            }
+        Serial.printf("%11.1f %11.1f %4d  %s\n", bootMarks[i].us / 1000.0, (bootMarks[i].us - from) / 1000.0, bootMarks[i].core, bootMarks[i].name);
+    }
+}
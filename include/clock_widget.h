@@ -0,0 +1,184 @@
+#pragma once
+#include <Arduino.h>
+#include <lvgl.h>
+
+#define CLOCK_GLYPHS "0123456789:" // Characters pre-rasterized by ClockWidget, colon must be the last
+
+// Clock text ("HH:MM:SS") drawn from glyph images rasterized once from the font, one fixed width cell
+// per character so a change only invalidate the cell of the character that actually changed.
+// Idle main screen on the native_ui build ("fbps" over 20 s) : about 92 KB/s flushed with the label, 17 KB/s with cells
+class ClockWidget
+{
+public:
+    static constexpr uint8_t maxCells = 8;
+    static constexpr uint8_t glyphCount = sizeof(CLOCK_GLYPHS) - 1;
+
+private:
+    struct Glyph
+    {
+        lv_img_dsc_t img;
+        lv_coord_t x, y; // Position inside the cell
+    } glyphs[glyphCount];
+    const lv_font_t* cacheFont = NULL;
+    lv_coord_t digitWidth, colonWidth, cellHeight;
+
+    lv_obj_t* container = NULL;
+    lv_obj_t* cells[maxCells];
+    lv_obj_t* cellImgs[maxCells];
+    lv_obj_t* fallbackLabel = NULL;
+    char text[maxCells + 1];
+
+    static lv_img_cf_t alphaFormat(uint8_t bpp)
+    {
+        switch (bpp) {
+        case 1: return LV_IMG_CF_ALPHA_1BIT;
+        case 2: return LV_IMG_CF_ALPHA_2BIT;
+        case 4: return LV_IMG_CF_ALPHA_4BIT;
+        case 8: return LV_IMG_CF_ALPHA_8BIT;
+        default: return LV_IMG_CF_UNKNOWN;
+        }
+    }
+
+    static int8_t glyphIndex(char c)
+    {
+        const char* p = strchr(CLOCK_GLYPHS, c);
+        return c && p ? p - CLOCK_GLYPHS : -1;
+    }
+
+    void freeCache()
+    {
+        for (uint8_t i = 0; i < glyphCount; i++) {
+            free((void*)glyphs[i].img.data);
+            glyphs[i].img.data = NULL;
+        }
+        cacheFont = NULL;
+    }
+
+    // Font bitmap rows are packed back to back, alpha images need each row to start on a byte
+    bool buildCache(const lv_font_t* font)
+    {
+        if (cacheFont == font)
+            return true;
+        freeCache();
+        memset(glyphs, 0, sizeof(glyphs));
+        lv_font_glyph_dsc_t dsc[glyphCount];
+        digitWidth = 0;
+        for (uint8_t i = 0; i < glyphCount; i++) {
+            if (!lv_font_get_glyph_dsc(font, &dsc[i], CLOCK_GLYPHS[i], 0) || alphaFormat(dsc[i].bpp) == LV_IMG_CF_UNKNOWN)
+                return false;
+            if (CLOCK_GLYPHS[i] != ':' && dsc[i].adv_w > digitWidth)
+                digitWidth = dsc[i].adv_w;
+        }
+        colonWidth = dsc[glyphCount - 1].adv_w;
+        cellHeight = lv_font_get_line_height(font);
+
+        for (uint8_t i = 0; i < glyphCount; i++) {
+            uint8_t bpp = dsc[i].bpp;
+            uint32_t stride = (dsc[i].box_w * bpp + 7) / 8;
+            uint32_t size = stride * dsc[i].box_h;
+            uint8_t* data = (uint8_t*)calloc(size ? size : 1, 1);
+            if (!data) {
+                freeCache();
+                return false;
+            }
+            const uint8_t* src = lv_font_get_glyph_bitmap(font, CLOCK_GLYPHS[i]);
+            uint32_t srcBit = 0;
+            for (uint16_t y = 0; y < dsc[i].box_h; y++)
+                for (uint16_t x = 0; x < dsc[i].box_w; x++, srcBit += bpp) {
+                    uint8_t value = (src[srcBit >> 3] >> (8 - bpp - (srcBit & 7))) & ((1 << bpp) - 1);
+                    uint32_t dstBit = x * bpp;
+                    data[y * stride + (dstBit >> 3)] |= value << (8 - bpp - (dstBit & 7));
+                }
+            Glyph& glyph = glyphs[i];
+            glyph.img.header.cf = alphaFormat(bpp);
+            glyph.img.header.always_zero = 0;
+            glyph.img.header.w = dsc[i].box_w;
+            glyph.img.header.h = dsc[i].box_h;
+            glyph.img.data_size = size;
+            glyph.img.data = data;
+            // Same placement as LVGL letter drawing, proportional glyph centered on the fixed cell
+            lv_coord_t cellWidth = CLOCK_GLYPHS[i] == ':' ? colonWidth : digitWidth;
+            glyph.x = (cellWidth - dsc[i].adv_w) / 2 + dsc[i].ofs_x;
+            glyph.y = cellHeight - font->base_line - dsc[i].box_h - dsc[i].ofs_y;
+        }
+        cacheFont = font;
+        return true;
+    }
+
+public:
+    uint32_t invalidatedArea = 0; // Pixels of the cells invalidated by set(), for redraw statistics
+
+    ClockWidget() { memset(glyphs, 0, sizeof(glyphs)); }
+    ~ClockWidget() { freeCache(); }
+
+    // Create the widget on parent, the glyph cache is built once per font and kept across screens.
+    // Fall back to a plain label when the font can't be cached
+    lv_obj_t* create(lv_obj_t* parent, const lv_font_t* font, lv_color_t color, const char* initText)
+    {
+        memset(text, 0, sizeof(text));
+        fallbackLabel = NULL;
+        container = lv_obj_create(parent);
+        lv_obj_remove_style_all(container);
+        lv_obj_clear_flag(container, LV_OBJ_FLAG_SCROLLABLE | LV_OBJ_FLAG_CLICKABLE);
+        if (!buildCache(font)) {
+            log_e("Clock glyph cache not available, using label");
+            lv_obj_set_size(container, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
+            fallbackLabel = lv_label_create(container);
+            lv_obj_set_style_text_font(fallbackLabel, font, 0);
+            lv_obj_set_style_text_color(fallbackLabel, color, 0);
+            set(initText);
+            return container;
+        }
+
+        uint8_t len = strlen(initText) < maxCells ? strlen(initText) : maxCells;
+        lv_coord_t x = 0;
+        for (uint8_t i = 0; i < len; i++) {
+            lv_coord_t cellWidth = initText[i] == ':' ? colonWidth : digitWidth;
+            cells[i] = lv_obj_create(container);
+            lv_obj_remove_style_all(cells[i]);
+            lv_obj_clear_flag(cells[i], LV_OBJ_FLAG_SCROLLABLE | LV_OBJ_FLAG_CLICKABLE);
+            lv_obj_set_size(cells[i], cellWidth, cellHeight);
+            lv_obj_set_pos(cells[i], x, 0);
+            cellImgs[i] = lv_img_create(cells[i]);
+            lv_obj_set_style_img_recolor(cellImgs[i], color, 0);
+            lv_obj_set_style_img_recolor_opa(cellImgs[i], LV_OPA_COVER, 0);
+            x += cellWidth;
+        }
+        for (uint8_t i = len; i < maxCells; i++)
+            cells[i] = cellImgs[i] = NULL;
+        lv_obj_set_size(container, x, cellHeight);
+        set(initText);
+        invalidatedArea = 0;
+        return container;
+    }
+
+    lv_obj_t* obj() { return container; }
+
+    // Update only the cells whose character changed, text layout must stay the same as on create()
+    void set(const char* newText)
+    {
+        if (fallbackLabel) {
+            lv_label_set_text(fallbackLabel, newText);
+            return;
+        }
+        for (uint8_t i = 0; i < maxCells && cells[i]; i++) {
+            char c = newText[i];
+            if (c == text[i])
+                continue;
+            int8_t index = glyphIndex(c);
+            if (index < 0) {
+                lv_obj_add_flag(cellImgs[i], LV_OBJ_FLAG_HIDDEN);
+            }
+            else {
+                lv_img_set_src(cellImgs[i], &glyphs[index].img);
+                lv_obj_set_pos(cellImgs[i], glyphs[index].x, glyphs[index].y);
+                lv_obj_clear_flag(cellImgs[i], LV_OBJ_FLAG_HIDDEN);
+            }
+            invalidatedArea += lv_obj_get_width(cells[i]) * cellHeight;
+            text[i] = c;
+            if (!c)
+                break;
+        }
+        text[maxCells] = 0;
+    }
+};
@@ -1,8 +1,10 @@
+#include "blog.h" // First, so every header log through the ring
 #include "lvgl.h"
 #include "colors.h"
 #include "keyboard_maps.h"
 #include "lgfx_config.h"
 #include "lvgl_core.h"
+#include "clock_widget.h"
 #include <SPIFFS.h>
 #include <SD.h>
 #include <Wire.h>
@@ -34,13 +36,23 @@ Device MAC List : 0xFC9B20F7C630 (First JamBel ever created)
 #define ESPSYS_FS SD
 #define PATH_ESPSYS "/espsys/"
 #define PATH_TJ "/espsys/tj/"
+#define PATH_TJ_IMPORT "/espsys/tj_import" // Staging folder for imported template jadwal
+#define PATH_JADWAL_IMPORT "/jadwal/" // CSV/JSON files on this folder are imported by "Import Jadwal"
+#define PATH_JADWAL_EXPORT "/jadwal/export/"
+#define PATH_FIRMWARE "/firmware.bin"
+#define PATH_FIRMWARE_SHA256 "/firmware.bin.sha256" // Hex SHA-256 of firmware.bin (sha256sum output), checked before the update is applied
+#define FW_UPDATE_ALLOW_UNVERIFIED 0 // 1 apply firmware.bin without PATH_FIRMWARE_SHA256, development only
+#define PATH_BELL_LOG "/bellog/" // Bell history, one YYYYMMDD.bin per day, see bell_log.h
+#define FW_UPDATE_CHUNK_SIZE 16384 // Multiple of SD sector and flash sector size
+#define FW_UPDATE_PROGRESS_PERIOD 250 // Minimum time between progress redraw (ms)
 
 #define MAX_BELL 30
 #define MAX_TEMPLATE_JADWAL 10
 #define TJ_HARIAN 0
 #define TJ_MINGGUAN 1
 #define FS_MAX_NAME_LEN 32
-#define TJ_MAX_LEN 10
+#define TJ_MANIFEST_MAGIC 0x4A544D46 // "JTMF"
+#define TJ_MANIFEST_VERSION 1
 
 #define I2S_MAX_GAIN 0.07
 #define I2S_MIN_GAIN 0.016
@@ -53,6 +65,8 @@ Device MAC List : 0xFC9B20F7C630 (First JamBel ever created)
 #define I2C_SDA GPIO_NUM_26
 #define I2C_SCL GPIO_NUM_25
 #define I2C_FREQ 100000U
+#define I2C_FREQ_RTC 400000U // DS3231 support fast mode
+#define I2C_FREQ_EXPANDER 100000U // PCF8574 is rated up to 100 kHz only
 
 #define SD_DI GPIO_NUM_33
 #define SD_DO GPIO_NUM_35
@@ -60,6 +74,9 @@ Device MAC List : 0xFC9B20F7C630 (First JamBel ever created)
 #define SD_CLK GPIO_NUM_32
 #define SDSPI_FREQUENCY 16000000U
 
+#define SCHEDULER_PERIOD 10 // Clock, bell check and relay timers period (ms)
+#define UI_BENCHMARK_SETTLE 600 // Wait after each "uibench" step, longer than the screen load animation (ms)
+
 LV_FONT_DECLARE(Montserrat_SemiBold91)
 LV_FONT_DECLARE(Montserrat_SemiBold48)
 
@@ -69,7 +86,7 @@ static lv_style_t style_flexRow;
 static lv_style_t style_thinBottomBorder;
 
 static lv_obj_t* mainScreen;
-static lv_obj_t* mainScreen_clock;
+static ClockWidget mainScreen_clock;
 static lv_obj_t* mainScreen_date;
 static lv_obj_t* mainScreen_tjName;
 static lv_obj_t* mainScreen_nextBellClock;
@@ -98,6 +115,24 @@ struct WidgetParameterData {
     void* param;
 };
 
+#define MODAL_POOL_ALERT_CNT 4 // Alert and confirm skeletons, the boot warnings alone may stack 3
+#define MODAL_POOL_ROLLPICK_CNT 2 // A confirm may open a rollpick before it's closed
+
+// Modal skeleton built once and parked hidden on lv_layer_top(). Opening it only set the texts and
+// theme, move it to the active screen and unhide it, closing park it back instead of deleting
+struct PooledModal {
+    lv_obj_t* overlay = NULL;
+    lv_obj_t* modal;
+    lv_obj_t* header; // Alert header box, NULL for other modals
+    lv_obj_t* title;
+    lv_obj_t* content; // Alert message label or rollpick roller
+    lv_obj_t* okButton;
+    lv_obj_t* cancelButton;
+    WidgetParameterData* wpd;
+    const char* options; // Roller options currently set, to not copy the same options again
+    bool used = false;
+};
+
 struct BelManual {
     bool enabled = false;
     char name[32] = "Kosong";
@@ -121,18 +156,29 @@ struct TemplateJadwal {
     }
 };
 
+// Header of PATH_ESPSYS"tj_manifest.bin", followed by count TemplateJadwal records
+struct TemplateJadwalManifest {
+    uint32_t magic;
+    uint16_t version;
+    uint16_t count;
+};
+
 const JadwalHari jw_empty({});
 const TemplateJadwal tj_empty("new", 0);
 JadwalHari *jw_used; // Current used jadwal harian
 JadwalHari *jw_temp; // Used for storing temporary data while editing jadwal harian at menu
 TemplateJadwal *tj_lists;
+uint16_t tj_lists_capacity;
 TemplateJadwal tj_used; // Currently used template jadwal
 TemplateJadwal tj_temp;
 static constexpr size_t belManual_len = 4;
 BelManual belManual[belManual_len];
-uint8_t tj_total_active;
+uint16_t tj_total_active;
 char tj_active_name[FS_MAX_NAME_LEN];
 WidgetParameterData tj_modalConfirmData;
+PooledModal modalPool_alert[MODAL_POOL_ALERT_CNT];
+PooledModal modalPool_rollpick[MODAL_POOL_ROLLPICK_CNT];
+PooledModal modalPool_belManual;
 int tj_issue_row;
 char tj_delete_confirm_message[128];
 
@@ -148,7 +194,9 @@ lv_obj_t* lvc_btn_init(lv_obj_t* btn, const char* labelText, lv_align_t align =
     lv_color_t bgColor = bs_indigo_500, lv_color_t textColor = bs_white,
     lv_text_align_t alignText = LV_TEXT_ALIGN_CENTER, lv_label_long_mode_t longMode = LV_LABEL_LONG_WRAP, lv_coord_t labelWidth = 0,
     lv_coord_t btnSizeX = 0, lv_coord_t btnSizeY = 0);
-lv_obj_t* lvc_create_overlay();
+lv_obj_t* lvc_create_overlay(lv_obj_t* parent = NULL);
+bool lvc_table_set_cell(lv_obj_t* table, uint16_t row, uint16_t col, const char* txt);
+void lvc_table_set_empty_row(lv_obj_t* table, bool empty, const char* message);
 void lvc_obj_set_pad_wrapper(lv_obj_t* obj, lv_coord_t padTop = 0xFF, lv_coord_t padBottom = 0xFF, lv_coord_t padLeft = 0xFF, lv_coord_t padRight = 0xFF, lv_style_selector_t selector = 0);
 void swipe_event_cb(lv_event_t* e);
 void belManual_btn_cb(lv_event_t* e);
@@ -158,7 +206,7 @@ uint8_t strToDow(const char* str);
 char kb_copy_buffer[128];
 void kb_custom_event_cb(lv_event_t* e);
 void kb_event_cb(lv_event_t* e);
-void tabelJadwalHariIni();
+void tabelJadwalHariIni(bool reload = false);
 void tj_ganti_template_btn_cb(lv_event_t* e);
 void tj_table_build();
 void tj_table_actionBtn_cb(lv_event_t* e);
@@ -175,15 +223,26 @@ bool templateJadwal_store(TemplateJadwal* tj_target);
 bool templateJadwal_activeName_update(const char* activeName);
 bool templateJadwal_activeName_load();
 bool templateJadwal_list_load();
+bool templateJadwal_list_reserve(uint16_t count);
+bool templateJadwal_manifest_store();
+bool templateJadwal_manifest_update(const char* oldName, TemplateJadwal* tj_target);
+bool templateJadwal_manifest_remove(const char* name);
 bool templateJadwal_create(TemplateJadwal* tj_target);
 bool templateJadwal_delete(TemplateJadwal* tj_target);
 bool templateJadwal_activeCount_load();
 bool templateJadwal_activeCount_store(int num);
 bool templateJadwal_changeUsedTJ(TemplateJadwal to, bool refreshElements, bool updateBinary);
+bool templateJadwal_import(const char* path, char* message, size_t messageLen);
+bool templateJadwal_export(TemplateJadwal* tj_target, const char* path, bool json);
 bool volume_store();
 bool volume_load();
 float volumeToGain(uint8_t volume);
 
+void modalPool_init();
+PooledModal* modalPool_acquire(PooledModal* pool, uint8_t count);
+void modalPool_open(PooledModal* pm);
+void modalPool_close(PooledModal* pm);
+void modalPool_closeAll();
 lv_obj_t* modal_create_alert(const char* message, const char* headerText = "Warning!",
     const lv_font_t* headerFont = &lv_font_montserrat_20, const lv_font_t* messageFont = &lv_font_montserrat_14,
     lv_color_t headerTextColor = bs_dark, lv_color_t textColor = bs_dark,
@@ -213,10 +272,14 @@ enum Expander{
 };
 
 namespace Traverser {
-#define TRAVERSER_MAX_ROW 50
+#define TRAVERSER_PAGE_ROWS 10 // Table only holds this much entries at once, the rest is fetched from SD when the page is changed
 #define TRAVERSER_MAX_TRAVERSING_LEN 128
     char traverseDirBuffer[TRAVERSER_MAX_TRAVERSING_LEN];
     bool exist; // Variable to store if traverser is exist
+    uint16_t entryCount; // Total listed file and folder within traverseDirBuffer
+    uint16_t pageIdx; // Currently shown page of traverseDirBuffer
+    uint16_t* pageStart; // Directory position of the first entry of every page, recorded by the counting pass
+    uint16_t pageStartCapacity;
 
     // Traverser objects
     lv_obj_t* overlay;
@@ -226,6 +289,11 @@ namespace Traverser {
     lv_obj_t* traversePathLabel;
     lv_obj_t* traverseCancelButton;
     lv_obj_t* traverseBox;
+    lv_obj_t* traverseTable;
+    lv_obj_t* pager;
+    lv_obj_t* pagePrevButton;
+    lv_obj_t* pageNextButton;
+    lv_obj_t* pageLabel;
 
     // Traverser issuer object and it's passed value
     lv_obj_t* traverserIssuer;
@@ -243,6 +311,12 @@ namespace Traverser {
     void traverserTableDrawEventCallback(lv_event_t* e);
     // Action button callback
     void traverserActionButtonClicked(lv_event_t* e);
+    // Fill the table with entries of the page, entries are read from SD on demand so table size is constant
+    void loadPage(uint16_t page);
+    // Previous/next page button callback, page offset is passed as user data
+    void pageButtonClicked(lv_event_t* e);
+    // Return true if file should be shown on traverser (folder or mp3 file, except system folders)
+    bool isListed(const char* name, bool isDir);
 }
 
 namespace TemplateJadwalBuilder {
@@ -0,0 +1,157 @@
+#pragma once
+#include <Arduino.h>
+#include <Wire.h>
+#include <RTClib.h>
+#include <pcf8574.h>
+#include <wall_clock.h>
+
+#define I2C_BUS_QUEUE_LEN 32 // Pending transactions, submit fail when full
+
+// Owner of Wire once started. Every other task submit typed transactions to the queue and read the time from
+// the WallClock resynced by the bus task, so there is no Wire access outside the bus task and no lock held around it.
+// Expander pin writes queued during one tick are staged on the driver and sent with a single commit()
+class I2cBus
+{
+public:
+    enum OpType : uint8_t
+    {
+        EXPANDER_PIN,
+        EXPANDER_BYTE,
+        RTC_ADJUST,
+        CLOCK_RESYNC
+    };
+    struct Op
+    {
+        OpType type;
+        uint8_t pin;
+        uint8_t value;
+        uint32_t unixtime; // RTC_ADJUST
+    };
+
+private:
+    QueueHandle_t queue = NULL;
+    TaskHandle_t task = NULL;
+    SemaphoreHandle_t mutex = NULL; // Held while Wire is in use, see lock()
+    RTC_DS3231* rtc;
+    pcf8574* expander;
+    WallClock* clock;
+    uint32_t rtcFreq, expanderFreq, busFreq = 0;
+    bool hunting = false; // Polling the RTC for the start of a second
+    uint8_t huntSecond;
+    int64_t huntUs;
+
+    // Each device at the highest clock it's rated for, Wire is only reconfigured when the device change
+    void setFreq(uint32_t freq)
+    {
+        if (freq != busFreq) {
+            Wire.setClock(freq);
+            busFreq = freq;
+        }
+    }
+
+    void startHunt()
+    {
+        hunting = true;
+        huntSecond = 0xFF;
+    }
+
+    // The seconds edge is between the previous poll and this one, the middle of both is taken as its time
+    void huntEdge()
+    {
+        setFreq(rtcFreq);
+        int64_t us = esp_timer_get_time();
+        DateTime t = rtc->now();
+        rtcReads++;
+        if (huntSecond != 0xFF && t.second() != huntSecond) {
+            clock->sync(t.unixtime(), (huntUs + us) / 2);
+            hunting = false;
+            return;
+        }
+        huntSecond = t.second();
+        huntUs = us;
+    }
+
+    bool submit(const Op& op)
+    {
+        if (queue && xQueueSend(queue, &op, 0) == pdTRUE)
+            return true;
+        queueFull++;
+        log_e("I2C queue full, transaction %d dropped", op.type);
+        return false;
+    }
+
+    void run()
+    {
+        Op op;
+        for (;;) {
+            uint32_t sinceSync = millis() - clock->lastSyncMillis;
+            TickType_t wait = hunting ? pdMS_TO_TICKS(WALLCLOCK_EDGE_POLL) : sinceSync >= resyncPeriod ? 0 : pdMS_TO_TICKS(resyncPeriod - sinceSync);
+            bool resync = false;
+            // Take everything already queued, the first receive sleeps until a transaction, the next poll or resync
+            bool received = xQueueReceive(queue, &op, wait) == pdTRUE;
+            xSemaphoreTake(mutex, portMAX_DELAY);
+            for (; received; received = xQueueReceive(queue, &op, 0) == pdTRUE) {
+                transactions++;
+                switch (op.type) {
+                case EXPANDER_PIN:
+                    expander->stage(op.pin, op.value);
+                    break;
+                case EXPANDER_BYTE:
+                    expander->stageByte(op.value);
+                    break;
+                case RTC_ADJUST:
+                    setFreq(rtcFreq);
+                    rtc->adjust(DateTime(op.unixtime));
+                    clock->set(op.unixtime);
+                    resync = true;
+                    break;
+                case CLOCK_RESYNC:
+                    resync = true;
+                    break;
+                }
+            }
+            if (expander->pending())
+                setFreq(expanderFreq);
+            expander->commit(); // One byte for the whole tick, none when the pins end up unchanged
+            if (!hunting && (resync || millis() - clock->lastSyncMillis >= resyncPeriod))
+                startHunt();
+            if (hunting)
+                huntEdge();
+            xSemaphoreGive(mutex);
+        }
+    }
+
+public:
+    uint32_t transactions = 0; // Taken from the queue
+    uint32_t rtcReads = 0, queueFull = 0;
+    uint32_t resyncPeriod = WALLCLOCK_RESYNC_PERIOD; // ms
+
+    // Wire, rtc and expander must be initialized. The clock is set from the RTC here so it's valid right away,
+    // the bus task then resync it on the next RTC second edge
+    bool begin(RTC_DS3231* _rtc, uint32_t _rtcFreq, pcf8574* _expander, uint32_t _expanderFreq, WallClock* _clock, BaseType_t core)
+    {
+        rtc = _rtc;
+        expander = _expander;
+        clock = _clock;
+        rtcFreq = _rtcFreq;
+        expanderFreq = _expanderFreq;
+        setFreq(rtcFreq);
+        clock->set(rtc->now().unixtime());
+        rtcReads++;
+        startHunt();
+        queue = xQueueCreate(I2C_BUS_QUEUE_LEN, sizeof(Op));
+        mutex = xSemaphoreCreateMutex();
+        return queue && mutex && xTaskCreatePinnedToCore([](void* bus) { ((I2cBus*)bus)->run(); }, "i2cTask", 3072, this, 4, &task, core) == pdPASS;
+    }
+
+    // Safe from any task on either core
+    bool expanderWrite(uint8_t pin, bool value) { return submit({ EXPANDER_PIN, pin, value, 0 }); }
+    bool expanderWriteByte(uint8_t value) { return submit({ EXPANDER_BYTE, 0, value, 0 }); }
+    bool rtcAdjust(const DateTime& dt) { return submit({ RTC_ADJUST, 0, 0, dt.unixtime() }); }
+    bool clockResync() { return submit({ CLOCK_RESYNC, 0, 0, 0 }); }
+
+    // Keep the bus task out of Wire, held by the power manager around light sleep. Queued transactions wait
+    void lock() { xSemaphoreTake(mutex, portMAX_DELAY); }
+    void unlock() { xSemaphoreGive(mutex); }
+    bool resyncing() { return hunting; } // Polling the RTC every WALLCLOCK_EDGE_POLL, sleeping would spoil the edge time
+};
@@ -1,4 +1,7 @@
 #pragma once
+#ifdef JAMBEL_HOST
+#include <lgfx_host.h> // Framebuffer in memory for the host build (env:native_ui)
+#else
 #define LGFX_USE_V1
 #include <LovyanGFX.hpp>
 
@@ -72,5 +75,6 @@ public:
     setPanel(&_panel_instance); // 使用するパネルをセットします。
   }
 };
+#endif
 
 LGFX tft;
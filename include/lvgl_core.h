@@ -1,5 +1,6 @@
 #include <lgfx_config.h>
 #include <lvgl.h>
+#include <boot_profile.h>
 
 LV_FONT_DECLARE(Montserrat_SemiBold91)
 LV_FONT_DECLARE(Montserrat_SemiBold48)
@@ -8,14 +9,115 @@ LV_FONT_DECLARE(Montserrat_SemiBold48)
 static const uint16_t screenWidth = 480;
 static const uint16_t screenHeight = 320;
 
+#define TOUCH_SAMPLES 3 // Reads per poll while the pen is down, each read is already a median of 7 by LovyanGFX
+#define TOUCH_MAX_SPREAD 10 // Samples spread wider than this (pixel) are dropped as noise
+#define LVGL_TASK_MAX_SLEEP 500 // Longest LVGL task sleep (ms), other task changing the UI call lvgl_wake()
+#define RENDER_STATS_LEN 32 // Frames kept for the "rstat" dump
+
+// LVGL heap budget (bytes) of each screen or modal, from "lvmem" dumps with some headroom. The sum of
+// the ones that can be open together (mainMenu tabs + builder + traverser + modals) must fit LV_MEM_SIZE
+#define LVMEM_BUDGET_MAIN_SCREEN 6144
+#define LVMEM_BUDGET_MENU_TAB1 8192
+#define LVMEM_BUDGET_MENU_TAB2 6144
+#define LVMEM_BUDGET_MENU_TAB3 4096
+#define LVMEM_BUDGET_MODAL_POOL 8192
+#define LVMEM_BUDGET_BEL_MANUAL 10240
+#define LVMEM_BUDGET_TRAVERSER 10240
+#define LVMEM_BUDGET_BUILDER 16384
+
+// Timing of one display refresh, collected from the lv_refr.c driver hooks (render_start_cb,
+// flush_cb, wait_cb, monitor_cb) so nothing extra is drawn on screen
+struct RenderFrameStat {
+    uint32_t time; // millis() at the end of the frame
+    uint32_t refrUs; // Whole refr_invalid_areas(), flushes included
+    uint32_t renderUs; // Drawing into the draw buffers
+    uint32_t maxPartUs; // Slowest single area part
+    uint32_t flushUs; // Inside my_disp_flush(), color conversion and DMA start
+    uint32_t waitUs; // Waiting for the DMA to free a draw buffer
+    uint32_t bytes;
+    uint32_t px;
+    uint16_t parts;
+};
+
+enum LvMemScopeId {
+    LVMEM_MAIN_SCREEN,
+    LVMEM_MENU_TAB1,
+    LVMEM_MENU_TAB2,
+    LVMEM_MENU_TAB3,
+    LVMEM_MODAL_POOL,
+    LVMEM_BEL_MANUAL,
+    LVMEM_TRAVERSER,
+    LVMEM_BUILDER,
+    LVMEM_SCOPE_CNT
+};
+
+// LVGL heap used by a screen or modal, measured as pool usage difference between begin and end.
+// Anything allocated by others in between is counted too, so it's an upper bound
+struct LvMemScope {
+    const char* name;
+    uint32_t budget;
+    uint32_t base; // Pool usage at lvgl_mem_scope_begin()
+    uint32_t used; // Usage at the last lvgl_mem_scope_end()
+    uint32_t peak;
+    uint16_t overBudget; // Times used was over budget
+    bool open; // Root object not deleted yet
+};
+
 void my_touchpad_read(lv_indev_drv_t* indev_driver, lv_indev_data_t* data);
 void my_disp_flush(lv_disp_drv_t* disp, const lv_area_t* area, lv_color_t* color_p);
+void my_disp_wait(lv_disp_drv_t* disp);
+void my_render_start(lv_disp_drv_t* disp);
+void my_render_monitor(lv_disp_drv_t* disp, uint32_t time, uint32_t px);
+void lvgl_render_stats_dump();
+void lvgl_flush_complete();
+uint32_t lvgl_measure_redraw();
+void lvgl_font_benchmark(const char* name, const lv_font_t* font);
+uint32_t lvgl_mem_used();
+void lvgl_mem_scope_begin(LvMemScope& scope);
+void lvgl_mem_scope_end(LvMemScope& scope, lv_obj_t* root = NULL);
+void lvgl_mem_dump();
 void printLVGLDebug(const char* buf);
 void lgfx_init();
+void touch_penirq_isr();
+void lvgl_task_cb(void* pvParameters);
+void lvgl_task_start();
+void lvgl_lock();
+void lvgl_unlock();
+void lvgl_wake();
+void lvgl_touch_wakeup();
 
+// ILI9488 on SPI only accept 18 bit color, so each draw buffer is sized for 3 bytes per pixel and
+// the RGB565 pixels rendered by LVGL are expanded in place before being sent with DMA
 const size_t pxBufCnt = screenWidth * 20;
 static lv_disp_draw_buf_t draw_buf;
-static lv_color_t buf[pxBufCnt];
+static lv_color_t* buf[2];
+static lv_disp_drv_t* flushPendingDisp = NULL; // Display waiting for its DMA transfer to finish
+static volatile bool touchPenIrq = false; // Set by PENIRQ falling edge
+static bool touchIrqEnabled = false;
+static int8_t touchPenIrqPin = -1; // Also a light sleep wake up source, see power_manager.h
+static bool touchPenDown = false;
+static lv_point_t touchLastPoint;
+static bool touchPointValid = false; // touchLastPoint come from the current press
+static lv_indev_t* touchIndev;
+SemaphoreHandle_t lvglMutex; // LVGL isn't thread safe, every lv_* call outside lvglTask must hold it
+TaskHandle_t lvglTask = NULL;
+uint32_t lvglFlushBytes = 0; // Bytes sent to the display since boot
+uint32_t lvglMemPeak = 0; // Highest LVGL heap usage seen by lvgl_mem_used(), max_used of lv_mem_monitor() is wrong (realloc not counted)
+static RenderFrameStat renderStats[RENDER_STATS_LEN]; // Ring buffer of the last frames
+static uint8_t renderStatsHead = 0; // Next slot to write
+static uint32_t renderFrameCount = 0; // Frames since boot
+static RenderFrameStat renderFrame; // Frame being rendered
+static uint32_t renderPartStart, renderPartWait; // Current area part render start and DMA wait time
+LvMemScope lvMemScopes[LVMEM_SCOPE_CNT] = {
+    {"mainScreen", LVMEM_BUDGET_MAIN_SCREEN},
+    {"mainMenu tab1", LVMEM_BUDGET_MENU_TAB1},
+    {"mainMenu tab2", LVMEM_BUDGET_MENU_TAB2},
+    {"mainMenu tab3", LVMEM_BUDGET_MENU_TAB3},
+    {"modal pool", LVMEM_BUDGET_MODAL_POOL},
+    {"bel manual", LVMEM_BUDGET_BEL_MANUAL},
+    {"traverser", LVMEM_BUDGET_TRAVERSER},
+    {"builder", LVMEM_BUDGET_BUILDER},
+};
 lv_disp_drv_t disp_drv;
 lv_indev_drv_t indev_drv;
 
@@ -24,15 +126,45 @@ void lgfx_init() {
     tft.fillScreen((0x0000));
     uint16_t params[8] = { 3782,3928,231,3932,3816,305,284,248 };
     // tft.calibrateTouch(params, TFT_WHITE, TFT_BLACK);
-    tft.setTouchCalibrate(params);
+    if (tft.touch()) // No touch controller on the host build
+        tft.setTouchCalibrate(params);
+
+    int8_t penIrqPin = tft.touch() ? tft.touch()->config().pin_int : -1;
+    if (penIrqPin >= 0) {
+        attachInterrupt(digitalPinToInterrupt(penIrqPin), touch_penirq_isr, FALLING);
+        touchPenIrqPin = penIrqPin;
+        touchIrqEnabled = true;
+    }
+    else
+        log_e("Touch PENIRQ pin not set, polling touch controller");
+}
+
+void IRAM_ATTR touch_penirq_isr() {
+    touchPenIrq = true;
+    BaseType_t higherPriorityTaskWoken = pdFALSE;
+    if (lvglTask) // Wake LVGL so the touch is read now instead of on the next input poll
+        vTaskNotifyGiveFromISR(lvglTask, &higherPriorityTaskWoken);
+    if (higherPriorityTaskWoken)
+        portYIELD_FROM_ISR();
 }
 
 void lvgl_esp32_init() {
 #if LV_USE_LOG != 0
     lv_log_register_print_cb(printLVGLDebug); /* register print function for debugging */
 #endif
+    lvglMutex = xSemaphoreCreateRecursiveMutex();
 
-    lv_disp_draw_buf_init(&draw_buf, buf, NULL, pxBufCnt);
+    // Two buffers so LVGL render the next strip while the previous one is transferred
+    for (uint8_t i = 0; i < 2; i++)
+        buf[i] = (lv_color_t*)heap_caps_malloc(pxBufCnt * sizeof(lgfx::bgr888_t), MALLOC_CAP_DMA);
+    if (!buf[0]) {
+        log_e("Could not allocate LVGL draw buffer");
+        buf[0] = buf[1];
+        buf[1] = NULL;
+    }
+    if (!buf[1])
+        log_e("LVGL running with single draw buffer");
+    lv_disp_draw_buf_init(&draw_buf, buf[0], buf[1], pxBufCnt);
 
     /*Initialize the display*/
     static lv_disp_drv_t disp_drv;
@@ -41,6 +173,9 @@ void lvgl_esp32_init() {
     disp_drv.hor_res = screenWidth;
     disp_drv.ver_res = screenHeight;
     disp_drv.flush_cb = my_disp_flush;
+    disp_drv.wait_cb = my_disp_wait;
+    disp_drv.render_start_cb = my_render_start;
+    disp_drv.monitor_cb = my_render_monitor;
     disp_drv.draw_buf = &draw_buf;
     lv_disp_drv_register(&disp_drv);
 
@@ -49,7 +184,54 @@ void lvgl_esp32_init() {
     lv_indev_drv_init(&indev_drv);
     indev_drv.type = LV_INDEV_TYPE_POINTER;
     indev_drv.read_cb = my_touchpad_read;
-    lv_indev_drv_register(&indev_drv);
+    touchIndev = lv_indev_drv_register(&indev_drv);
+}
+
+// Run LVGL timers, then sleep until the next one is due or until woken by touch or lvgl_wake(). While the last
+// DMA transfer of a frame is running, wake every tick to end it
+void lvgl_task_cb(void* pvParameters) {
+    log_i("lvglTask running on core %d", xPortGetCoreID());
+    for (;;) {
+        lvgl_lock();
+        if (touchPenIrq)
+            lv_timer_ready(touchIndev->driver->read_timer);
+        uint32_t sleepTime = lv_timer_handler();
+        // The last strip of a frame is only released here, nothing else wait for it
+        if (flushPendingDisp && !tft.dmaBusy())
+            lvgl_flush_complete();
+        bool flushPending = flushPendingDisp != NULL;
+        lvgl_unlock();
+        if (sleepTime > LVGL_TASK_MAX_SLEEP)
+            sleepTime = LVGL_TASK_MAX_SLEEP;
+        if (flushPending) // Poll the DMA every tick, so the SPI transaction isn't held until the next frame
+            sleepTime = 0;
+        TickType_t sleepTicks = pdMS_TO_TICKS(sleepTime);
+        ulTaskNotifyTake(pdTRUE, sleepTicks ? sleepTicks : 1);
+    }
+}
+
+void lvgl_task_start() {
+    xTaskCreatePinnedToCore(lvgl_task_cb, "lvglTask", 8192, NULL, 2, &lvglTask, 1);
+}
+
+void lvgl_lock() {
+    xSemaphoreTakeRecursive(lvglMutex, portMAX_DELAY);
+}
+
+void lvgl_unlock() {
+    xSemaphoreGiveRecursive(lvglMutex);
+}
+
+// Call after changing the UI from other task, so it's redrawn without waiting for LVGL_TASK_MAX_SLEEP
+void lvgl_wake() {
+    if (lvglTask)
+        xTaskNotifyGive(lvglTask);
+}
+
+// Touch woke the device from light sleep, the PENIRQ edge went by while its interrupt was off
+void lvgl_touch_wakeup() {
+    touchPenIrq = true;
+    lvgl_wake();
 }
 
 #if LV_USE_LOG != 0
@@ -63,29 +245,262 @@ void printLVGLDebug(const char* buf)
 
 void my_disp_flush(lv_disp_drv_t* disp, const lv_area_t* area, lv_color_t* color_p)
 {
+    uint32_t start = micros();
+    uint32_t partUs = start - renderPartStart - renderPartWait;
+    renderFrame.renderUs += partUs;
+    if (partUs > renderFrame.maxPartUs)
+        renderFrame.maxPartUs = partUs;
+    renderFrame.parts++;
+
     uint32_t w = (area->x2 - area->x1 + 1);
     uint32_t h = (area->y2 - area->y1 + 1);
+    uint32_t len = w * h;
 
-    tft.startWrite();
+    // Expand RGB565 to the panel 3 bytes format in place, from the last pixel so no source pixel is overwritten
+    lgfx::rgb565_t* src = (lgfx::rgb565_t*)&color_p->full;
+    lgfx::bgr888_t* dst = (lgfx::bgr888_t*)color_p;
+    for (uint32_t i = len; i-- > 0;) {
+        lgfx::rgb565_t c = src[i];
+        dst[i] = c;
+    }
+
+    tft.startWrite(); // Transaction stay open until the DMA is finished, closed on lvgl_flush_complete()
     tft.setAddrWindow(area->x1, area->y1, w, h);
-    //tft.pushColors( ( uint16_t * )&color_p->full, w * h, true );
-    tft.writePixels((lgfx::rgb565_t*)&color_p->full, w * h);
-    tft.endWrite();
+    tft.writePixelsDMA(dst, len);
+    lvglFlushBytes += len * sizeof(lgfx::bgr888_t);
+    renderFrame.bytes += len * sizeof(lgfx::bgr888_t);
+    flushPendingDisp = disp;
+    renderPartStart = micros();
+    renderPartWait = 0;
+    renderFrame.flushUs += renderPartStart - start;
+}
+
+// Called by LVGL while it wait for the flushing buffer, release it as soon as the DMA is done
+void my_disp_wait(lv_disp_drv_t* disp)
+{
+    uint32_t start = micros();
+    if (flushPendingDisp && !tft.dmaBusy())
+        lvgl_flush_complete();
+    uint32_t waitUs = micros() - start;
+    renderPartWait += waitUs;
+    renderFrame.waitUs += waitUs;
+}
+
+// Called by LVGL before rendering the invalidated areas of a frame
+void my_render_start(lv_disp_drv_t* disp)
+{
+    memset(&renderFrame, 0, sizeof(renderFrame));
+    renderPartStart = micros();
+    renderPartWait = 0;
+    renderFrame.refrUs = renderPartStart; // Turned into duration by my_render_monitor()
+}
+
+// Called by LVGL after a frame was rendered and flushed (last transfer may still be running)
+void my_render_monitor(lv_disp_drv_t* disp, uint32_t time, uint32_t px)
+{
+    renderFrame.refrUs = micros() - renderFrame.refrUs;
+    renderFrame.time = millis();
+    renderFrame.px = px;
+    renderStats[renderStatsHead] = renderFrame;
+    renderStatsHead = (renderStatsHead + 1) % RENDER_STATS_LEN;
+    lvgl_mem_used(); // Sample the heap peak once per frame
+    if (renderFrameCount++ == 0)
+        boot_mark("first frame on display");
+}
+
+// Print the frames kept in the ring buffer, oldest first, with their average and the frame rate
+void lvgl_render_stats_dump()
+{
+    uint8_t count = renderFrameCount < RENDER_STATS_LEN ? renderFrameCount : RENDER_STATS_LEN;
+    if (count == 0) {
+        Serial.println("Render : no frame yet");
+        return;
+    }
+    uint8_t first = (renderStatsHead + RENDER_STATS_LEN - count) % RENDER_STATS_LEN;
+    RenderFrameStat sum = {};
+    Serial.printf("Render : %lu frames since boot\n      time   refr render maxPart  flush   wait  bytes     px parts\n", renderFrameCount);
+    for (uint8_t i = 0; i < count; i++) {
+        const RenderFrameStat& f = renderStats[(first + i) % RENDER_STATS_LEN];
+        Serial.printf("%10lu %6lu %6lu %7lu %6lu %6lu %6lu %6lu %5u\n", f.time, f.refrUs, f.renderUs, f.maxPartUs, f.flushUs,
+            f.waitUs, f.bytes, f.px, f.parts);
+        sum.refrUs += f.refrUs;
+        sum.renderUs += f.renderUs;
+        sum.flushUs += f.flushUs;
+        sum.waitUs += f.waitUs;
+        sum.bytes += f.bytes;
+        if (f.maxPartUs > sum.maxPartUs)
+            sum.maxPartUs = f.maxPartUs;
+    }
+    Serial.printf("%10s %6lu %6lu %7lu %6lu %6lu %6lu\n", "avg", sum.refrUs / count, sum.renderUs / count, sum.maxPartUs,
+        sum.flushUs / count, sum.waitUs / count, sum.bytes / count);
+    uint32_t span = renderStats[(first + count - 1) % RENDER_STATS_LEN].time - renderStats[first].time;
+    if (count > 1 && span > 0)
+        Serial.printf("Frame rate : %lu.%lu fps over the last %u frames\n", (count - 1) * 1000 / span, (count - 1) * 10000 / span % 10, count);
+}
 
+// Block until the pending DMA transfer finish, must be called before using the SPI bus for anything else
+void lvgl_flush_complete()
+{
+    if (!flushPendingDisp)
+        return;
+    tft.waitDMA();
+    tft.endWrite();
+    lv_disp_drv_t* disp = flushPendingDisp;
+    flushPendingDisp = NULL;
     lv_disp_flush_ready(disp);
 }
 
+// Redraw the whole active screen now and return the time it take (us), last transfer included
+uint32_t lvgl_measure_redraw()
+{
+    lv_obj_invalidate(lv_scr_act());
+    uint32_t start = micros();
+    lv_refr_now(NULL);
+    lvgl_flush_complete();
+    return micros() - start;
+}
+
+// Print glyph lookup and render time of the clock characters with font, to compare the output of
+// tools/font_subset.py (bpp, kerning) on the device. Glyphs are drawn on an off screen canvas
+void lvgl_font_benchmark(const char* name, const lv_font_t* font)
+{
+    const char* chars = "0123456789:";
+    const uint8_t charCount = strlen(chars);
+    const uint16_t lookupRounds = 1000, drawRounds = 20;
+    lv_coord_t size = lv_font_get_line_height(font);
+    lv_color_t* canvasBuf = (lv_color_t*)malloc(LV_CANVAS_BUF_SIZE_TRUE_COLOR(size, size));
+    if (!canvasBuf) {
+        log_e("No memory for font benchmark canvas");
+        return;
+    }
+
+    lv_font_glyph_dsc_t dsc;
+    uint32_t bitmapBytes = 0;
+    uint8_t bpp = 0;
+    for (uint8_t i = 0; i < charCount; i++)
+        if (lv_font_get_glyph_dsc(font, &dsc, chars[i], 0)) {
+            bitmapBytes += ((uint32_t)dsc.box_w * dsc.box_h * dsc.bpp + 7) / 8;
+            bpp = dsc.bpp;
+        }
+
+    uint32_t start = micros();
+    for (uint16_t r = 0; r < lookupRounds; r++)
+        for (uint8_t i = 0; i < charCount; i++)
+            lv_font_get_glyph_dsc(font, &dsc, chars[i], chars[i + 1]);
+    uint32_t lookupTime = micros() - start;
+
+    lv_obj_t* canvas = lv_canvas_create(lv_layer_top());
+    lv_obj_add_flag(canvas, LV_OBJ_FLAG_HIDDEN);
+    lv_canvas_set_buffer(canvas, canvasBuf, size, size, LV_IMG_CF_TRUE_COLOR);
+    lv_draw_label_dsc_t label_dsc;
+    lv_draw_label_dsc_init(&label_dsc);
+    label_dsc.font = font;
+    label_dsc.color = lv_color_white();
+    char glyph[2] = {0, 0};
+    start = micros();
+    for (uint16_t r = 0; r < drawRounds; r++)
+        for (uint8_t i = 0; i < charCount; i++) {
+            glyph[0] = chars[i];
+            lv_canvas_draw_text(canvas, 0, 0, size, &label_dsc, glyph);
+        }
+    uint32_t drawTime = micros() - start;
+    lv_obj_del(canvas);
+    free(canvasBuf);
+
+    Serial.printf("%s : %u bpp, %lu B bitmap, lookup %lu ns/glyph, draw %lu us/glyph\n", name, bpp, bitmapBytes,
+        (uint32_t)((uint64_t)lookupTime * 1000 / (lookupRounds * charCount)), drawTime / (drawRounds * charCount));
+}
+
+// Also update lvglMemPeak, so the peak is sampled wherever usage is read
+uint32_t lvgl_mem_used()
+{
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    uint32_t used = mon.total_size - mon.free_size;
+    if (used > lvglMemPeak)
+        lvglMemPeak = used;
+    return used;
+}
+
+void lvgl_mem_scope_begin(LvMemScope& scope)
+{
+    scope.base = lvgl_mem_used();
+}
+
+// Can be called again after the scope rebuild part of itself, used is always measured from begin.
+// root deletion mark the scope closed for the dump
+void lvgl_mem_scope_end(LvMemScope& scope, lv_obj_t* root)
+{
+    uint32_t used = lvgl_mem_used();
+    scope.used = used > scope.base ? used - scope.base : 0;
+    if (scope.used > scope.peak)
+        scope.peak = scope.used;
+    if (scope.used > scope.budget) {
+        scope.overBudget++;
+        log_e("LVGL heap of %s is %lu B, over its %lu B budget", scope.name, scope.used, scope.budget);
+    }
+    if (root && !scope.open) {
+        scope.open = true;
+        lv_obj_add_event_cb(root, [](lv_event_t* e) {
+            ((LvMemScope*)lv_event_get_user_data(e))->open = false;
+            }, LV_EVENT_DELETE, &scope);
+    }
+}
+
+// Print LVGL heap usage, fragmentation and the usage of each screen or modal
+void lvgl_mem_dump()
+{
+    uint32_t used = lvgl_mem_used();
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    Serial.printf("LVGL heap : %lu/%lu B used (%u%%), peak %lu B, biggest free %lu B, frag %u%%, %lu used/%lu free blocks\n",
+        used, mon.total_size, mon.used_pct, lvglMemPeak, mon.free_biggest_size, mon.frag_pct, mon.used_cnt, mon.free_cnt);
+    uint32_t openSum = 0;
+    for (uint8_t i = 0; i < LVMEM_SCOPE_CNT; i++) {
+        const LvMemScope& scope = lvMemScopes[i];
+        Serial.printf("  %-14s %6lu B  peak %6lu B  budget %6lu B%s%s\n", scope.name, scope.used, scope.peak, scope.budget,
+            scope.open ? "  open" : "", scope.overBudget ? "  OVER" : "");
+        if (scope.open)
+            openSum += scope.used;
+    }
+    Serial.printf("  %-14s %6lu B\n", "other", used > openSum ? used - openSum : 0);
+}
+
 void my_touchpad_read(lv_indev_drv_t* indev_driver, lv_indev_data_t* data)
 {
-    uint16_t touchX, touchY;
-    bool touched = tft.getTouch(&touchX, &touchY);
-    if (!touched)
+    // Nothing to read until PENIRQ fire, so the SPI bus shared with the display stay free for DMA.
+    // The controller also pulse PENIRQ while being read, those only cost one pin check in getTouch()
+    if (touchIrqEnabled && !touchPenIrq && !touchPenDown) {
         data->state = LV_INDEV_STATE_REL;
-    else
-    {
-        data->state = LV_INDEV_STATE_PR;
-        /*Set the coordinates*/
-        data->point.x = touchX;
-        data->point.y = touchY;
+        data->point = touchLastPoint;
+        return;
     }
-}
\ No newline at end of file
+    touchPenIrq = false;
+    lvgl_flush_complete(); // Touch controller share the SPI bus with the display
+
+    uint16_t touchX, touchY;
+    uint32_t sumX = 0, sumY = 0;
+    uint16_t minX = UINT16_MAX, maxX = 0, minY = UINT16_MAX, maxY = 0;
+    uint8_t count = 0;
+    while (count < TOUCH_SAMPLES && tft.getTouch(&touchX, &touchY)) {
+        sumX += touchX;
+        sumY += touchY;
+        if (touchX < minX) minX = touchX;
+        if (touchX > maxX) maxX = touchX;
+        if (touchY < minY) minY = touchY;
+        if (touchY > maxY) maxY = touchY;
+        count++;
+    }
+    touchPenDown = count > 0;
+    // Move the point only on a full and consistent set of samples, otherwise keep the last one of this press.
+    // Until the press gave one it stay released, so a touch is never reported at the previous press position
+    if (count == TOUCH_SAMPLES && maxX - minX <= TOUCH_MAX_SPREAD && maxY - minY <= TOUCH_MAX_SPREAD) {
+        touchLastPoint.x = sumX / count;
+        touchLastPoint.y = sumY / count;
+        touchPointValid = true;
+    }
+    else if (!touchPenDown)
+        touchPointValid = false;
+    data->state = touchPenDown && touchPointValid ? LV_INDEV_STATE_PR : LV_INDEV_STATE_REL;
+    data->point = touchLastPoint;
+}
@@ -1,14 +1,15 @@
+#pragma once
 #include <stopwatch.h>
 
 // On-delay timer, Q is ON after DIN is TRUE for PT duration
 class TON
 {
     uint32_t pt, lastMillis;
-    bool input;
+    bool input = false;
     Stopwatch sw;
 
 public:
-    TON(uint32_t _pt) : pt(_pt) {}
+    TON(uint32_t _pt, Stopwatch::Clock clock = Stopwatch::defaultClock) : pt(_pt), sw(clock) {}
     void setPT(uint32_t _pt) { pt = _pt; }
     uint32_t getPT() { return pt; }
     // Timer will count as long as din is hold true, and will be reset when reset input is true
@@ -47,7 +48,7 @@ class TOFF
     }
 
 public:
-    TOFF(uint32_t _pt) : pt(_pt) {}
+    TOFF(uint32_t _pt, Stopwatch::Clock clock = Stopwatch::defaultClock) : sw(clock), pt(_pt) {}
     void setPT(uint32_t _pt) { pt = _pt; }
     uint32_t getPT() { return pt; }
     // Timer will count after falling edge of din, if din became true again then timer count reset, and timer will reset when reset input is true
@@ -98,7 +99,7 @@ class TP
     }
 
 public:
-    TP(uint32_t _pt) : pt(_pt) {}
+    TP(uint32_t _pt, Stopwatch::Clock clock = Stopwatch::defaultClock) : sw(clock), pt(_pt) {}
     uint32_t getPT() { return pt; }
     void setPT(uint32_t _pt) { pt = _pt; }
 
@@ -0,0 +1,144 @@
+#pragma once
+#include <Arduino.h>
+#include <esp_sleep.h>
+#include <esp_timer.h>
+#include <driver/gpio.h>
+#include <driver/uart.h>
+
+/*
+Power states, picked by the caller on every loop() :
+  PM_ACTIVE : PM_FREQ_ACTIVE MHz. UI touched in the last PM_IDLE_TIMEOUT, bell or audio running, or a bell due
+              within PM_BELL_PREROLL
+  PM_IDLE   : PM_FREQ_IDLE MHz, awake between two light sleeps
+  PM_SLEEP  : light sleep, both CPUs and the peripheral clocks are stopped, the display keep its image
+The Arduino core isn't built with tickless idle, so the automatic light sleep of esp_pm isn't available and
+sleep() is entered explicitly by the caller once every bus is idle. Wake sources are the touch PENIRQ (level),
+UART0 RX and a timer on the next wall clock second (the RTC SQW pin isn't wired) or the bell pre-roll.
+PM_FREQ_IDLE stay at 80 MHz, lower clocks also slow down APB and so the SPI, I2C and UART baud rates.
+
+Bell latency budget : the device is back to PM_ACTIVE at least PM_BELL_PREROLL - 1 s before a bell, so the
+bell itself rings with the same latency as without power management (one SCHEDULER_PERIOD + one I2C tick).
+A timer wake up later than PM_WAKE_LATE_BUDGET eat into the pre-roll and is logged as an error.
+
+Serial console wake preamble : the characters that wake the UART are lost, so send a blank line (Enter, "\r\n")
+first, then the command. Any RX keep the device out of light sleep for PM_UART_AWAKE, the following commands
+are received whole. A lost or partial preamble only end as an empty message on the console parser.
+*/
+
+#define PM_LIGHT_SLEEP 1 // 0 keep the clock scaling only
+#define PM_FREQ_ACTIVE 240 // MHz
+#define PM_FREQ_IDLE 80 // MHz
+#define PM_IDLE_TIMEOUT 30000 // No touch for this long before leaving PM_ACTIVE (ms)
+#define PM_BELL_PREROLL 5000 // Stay PM_ACTIVE this long before a scheduled bell (ms)
+#define PM_WAKE_LATE_BUDGET 1000000 // Timer wake up lateness allowed by the pre-roll (us)
+#define PM_MIN_AWAKE 100 // Awake time after a wake up, for the scheduler tick and the clock redraw (ms)
+#define PM_SLEEP_RESYNC_PERIOD 60000 // Wall clock resync period while sleeping, esp_timer run from the RC slow clock in light sleep (ms)
+#define PM_UART_WAKE_THRESHOLD 3 // RX edges to wake up, the characters that wake are lost (see wake preamble)
+#define PM_UART_AWAKE 30000 // No light sleep for this long after a UART wake up or any RX (ms)
+
+enum PowerState : uint8_t
+{
+    PM_ACTIVE,
+    PM_IDLE,
+    PM_SLEEP,
+    PM_STATE_CNT
+};
+
+class PowerManager
+{
+    PowerState state = PM_ACTIVE;
+    int64_t stateSinceUs = 0;
+    int8_t touchPin = -1;
+    uint64_t stateUs[PM_STATE_CNT] = {};
+
+public:
+    uint32_t sleeps = 0, wakeTimer = 0, wakeTouch = 0, wakeUart = 0;
+    int32_t worstWakeLateUs = 0; // Timer wake ups against PM_WAKE_LATE_BUDGET
+    uint32_t awakeMillis = 0; // millis() of the last wake up
+    uint32_t rxMillis = 0; // millis() of the last UART RX or UART wake up
+    bool rxSeen = false;
+
+    // penIrqPin is the touch PENIRQ GPIO (active low), or -1 when touch is polled
+    void begin(int8_t penIrqPin)
+    {
+        touchPin = penIrqPin;
+        stateSinceUs = esp_timer_get_time();
+        uart_set_wakeup_threshold(UART_NUM_0, PM_UART_WAKE_THRESHOLD);
+        esp_sleep_enable_uart_wakeup(UART_NUM_0);
+        if (touchPin >= 0)
+            esp_sleep_enable_gpio_wakeup();
+    }
+
+    void enter(PowerState s)
+    {
+        if (s == state)
+            return;
+        int64_t us = esp_timer_get_time();
+        stateUs[state] += us - stateSinceUs;
+        stateSinceUs = us;
+        if (s == PM_ACTIVE)
+            setCpuFrequencyMhz(PM_FREQ_ACTIVE);
+        else if (state == PM_ACTIVE)
+            setCpuFrequencyMhz(PM_FREQ_IDLE);
+        state = s;
+    }
+
+    // Light sleep for at most us. The caller hold every task that could be in the middle of a transfer
+    // (display DMA, SD, I2C, audio) and have flushed Serial. Return the wake up cause
+    esp_sleep_wakeup_cause_t sleep(uint64_t us)
+    {
+        enter(PM_SLEEP);
+        esp_sleep_enable_timer_wakeup(us);
+        if (touchPin >= 0) { // Level wake up, with the edge interrupt off so it doesn't fire on the level
+            gpio_intr_disable((gpio_num_t)touchPin);
+            gpio_wakeup_enable((gpio_num_t)touchPin, GPIO_INTR_LOW_LEVEL);
+        }
+        int64_t start = esp_timer_get_time();
+        esp_light_sleep_start();
+        int32_t lateUs = esp_timer_get_time() - start - us;
+        if (touchPin >= 0) {
+            gpio_wakeup_disable((gpio_num_t)touchPin);
+            gpio_set_intr_type((gpio_num_t)touchPin, GPIO_INTR_NEGEDGE);
+            gpio_intr_enable((gpio_num_t)touchPin);
+        }
+        esp_sleep_wakeup_cause_t cause = esp_sleep_get_wakeup_cause();
+        sleeps++;
+        if (cause == ESP_SLEEP_WAKEUP_TIMER) {
+            wakeTimer++;
+            if (lateUs > worstWakeLateUs)
+                worstWakeLateUs = lateUs;
+            if (lateUs > PM_WAKE_LATE_BUDGET)
+                log_e("Light sleep wake up %ld us late, over the bell pre-roll budget", lateUs);
+        }
+        else if (cause == ESP_SLEEP_WAKEUP_GPIO)
+            wakeTouch++;
+        else if (cause == ESP_SLEEP_WAKEUP_UART)
+            wakeUart++;
+        enter(PM_IDLE);
+        awakeMillis = millis();
+        if (cause == ESP_SLEEP_WAKEUP_UART)
+            uartActivity();
+        return cause;
+    }
+
+    // Serial data received, the rest of the command is coming
+    void uartActivity()
+    {
+        rxMillis = millis();
+        rxSeen = true;
+    }
+
+    // Light sleep would drop the start of the next characters
+    bool uartAwake() { return rxSeen && millis() - rxMillis < PM_UART_AWAKE; }
+
+    PowerState current() { return state; }
+
+    // Time spent in s since begin(), the current state included (ms)
+    uint32_t timeIn(PowerState s)
+    {
+        uint64_t us = stateUs[s];
+        if (s == state)
+            us += esp_timer_get_time() - stateSinceUs;
+        return us / 1000;
+    }
+};
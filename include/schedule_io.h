@@ -0,0 +1,534 @@
+#pragma once
+#include <Arduino.h>
+
+/*
+Streaming reader and writer for template jadwal exchange files.
+Files are read character by character with fixed size buffers, so memory use doesn't depend on the file size.
+
+CSV, one bell per line, separated by ',' or ';' (header line and lines starting with '#' are skipped) :
+  hari,jam,nama,audio
+  Senin,07:00,Masuk,/bel/masuk.mp3
+  Setiap Hari,12:00,Istirahat,/bel/istirahat.mp3
+
+JSON, every object that has "jam" key is a bell :
+  {"name":"Reguler","tipe":"mingguan","bel":[{"hari":"Senin","jam":"07:00","nama":"Masuk","audio":"/bel/masuk.mp3"}]}
+
+hari is day name (Minggu..Sabtu), day number 0..6, or "Setiap Hari"/"*"/empty for every day.
+jam is "HH:MM" or HHMM.
+*/
+
+#define SCHEDULE_NAME_LEN 32
+#define SCHEDULE_AUDIO_LEN 128
+#define SCHEDULE_EVERY_DAY -1
+#define SCHEDULE_TIPE_UNKNOWN -1
+
+struct ScheduleRow
+{
+    int8_t hari; // 0 (Minggu) to 6 (Sabtu), or SCHEDULE_EVERY_DAY
+    uint16_t jadwal; // HHMM, same as JadwalHari::jadwalBel
+    char nama[SCHEDULE_NAME_LEN];
+    char audio[SCHEDULE_AUDIO_LEN];
+};
+
+namespace ScheduleIO
+{
+    static const char* const dayNames[7] = { "Minggu", "Senin", "Selasa", "Rabu", "Kamis", "Jumat", "Sabtu" };
+
+    // Return true if str is day name, day number or every day marker, result is stored on hari
+    inline bool parseHari(const char* str, int8_t& hari)
+    {
+        if (*str == 0 || strcmp(str, "*") == 0 || strcasecmp(str, "Setiap Hari") == 0)
+        {
+            hari = SCHEDULE_EVERY_DAY;
+            return true;
+        }
+        if (str[0] >= '0' && str[0] <= '6' && str[1] == 0)
+        {
+            hari = str[0] - '0';
+            return true;
+        }
+        for (int8_t i = 0; i < 7; i++)
+        {
+            if (strcasecmp(str, dayNames[i]) == 0)
+            {
+                hari = i;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Return true if str is valid "HH:MM" or HHMM time, result is stored as HHMM on jadwal
+    inline bool parseJam(const char* str, uint16_t& jadwal)
+    {
+        int digits[4];
+        int count = 0;
+        bool colon = false;
+        for (const char* p = str; *p; p++)
+        {
+            if (*p >= '0' && *p <= '9')
+            {
+                if (count == 4)
+                    return false;
+                digits[count++] = *p - '0';
+            }
+            else if (*p == ':' && !colon)
+            {
+                colon = true;
+                if (count == 1) // Allow "7:00"
+                {
+                    digits[1] = digits[0];
+                    digits[0] = 0;
+                    count = 2;
+                }
+                else if (count != 2)
+                    return false;
+            }
+            else
+                return false;
+        }
+        if (count == 3 && !colon) // Allow 700 like TemplateJadwalBuilder numeric input
+        {
+            digits[3] = digits[2];
+            digits[2] = digits[1];
+            digits[1] = digits[0];
+            digits[0] = 0;
+            count = 4;
+        }
+        if (count != 4)
+            return false;
+        int hour = digits[0] * 10 + digits[1];
+        int minute = digits[2] * 10 + digits[3];
+        if (hour > 23 || minute > 59)
+            return false;
+        jadwal = hour * 100 + minute;
+        return true;
+    }
+
+    inline bool copyField(char* dst, const char* src, size_t len)
+    {
+        if (strlen(src) >= len)
+            return false;
+        strcpy(dst, src);
+        return true;
+    }
+}
+
+class ScheduleReader
+{
+protected:
+    Stream& stream;
+    uint32_t lineNumber = 1;
+    uint32_t rowLine = 0;
+    char errorMessage[64] = { 0 };
+
+    bool fail(const char* message)
+    {
+        snprintf(errorMessage, sizeof(errorMessage), "Baris %lu : %s", (unsigned long)lineNumber, message);
+        return false;
+    }
+    int readChar()
+    {
+        int c = stream.read();
+        if (c == '\n')
+            lineNumber++;
+        return c;
+    }
+
+public:
+    char templateName[SCHEDULE_NAME_LEN] = { 0 }; // Filled when the file carries the name (JSON only)
+    int8_t tipe = SCHEDULE_TIPE_UNKNOWN; // TJ_HARIAN/TJ_MINGGUAN when the file carries the type (JSON only)
+
+    ScheduleReader(Stream& _stream) : stream(_stream) {}
+    virtual ~ScheduleReader() {}
+    // Read the next bell, return false on end of file or error
+    virtual bool next(ScheduleRow& row) = 0;
+    // Empty when next() returned false because of end of file
+    const char* error() { return errorMessage; }
+    // Line number of the last bell returned by next()
+    uint32_t line() { return rowLine; }
+};
+
+class CsvScheduleReader : public ScheduleReader
+{
+    static constexpr size_t maxLineLen = 256;
+    char lineBuffer[maxLineLen];
+    bool firstLine = true;
+
+    // Split one field from p, handling "quoted" field with "" escape. Return pointer after the separator or NULL on last field
+    static char* splitField(char* p, char** field)
+    {
+        if (*p == '"')
+        {
+            char* out = ++p;
+            *field = out;
+            while (*p)
+            {
+                if (*p == '"' && p[1] == '"')
+                {
+                    *out++ = '"';
+                    p += 2;
+                }
+                else if (*p == '"')
+                {
+                    p++;
+                    break;
+                }
+                else
+                    *out++ = *p++;
+            }
+            *out = 0;
+            while (*p && *p != ',' && *p != ';')
+                p++;
+        }
+        else
+        {
+            *field = p;
+            while (*p && *p != ',' && *p != ';')
+                p++;
+        }
+        if (*p == 0)
+            return NULL;
+        *p = 0;
+        return p + 1;
+    }
+
+    // Read one line to lineBuffer, return false on end of file
+    bool readLine()
+    {
+        size_t len = 0;
+        int c;
+        bool overflow = false;
+        while ((c = stream.read()) >= 0 && c != '\n')
+        {
+            if (c == '\r')
+                continue;
+            if (len < maxLineLen - 1)
+                lineBuffer[len++] = c;
+            else
+                overflow = true;
+        }
+        lineBuffer[len] = 0;
+        if (overflow)
+            lineBuffer[0] = 0x01; // Marked as invalid line
+        return c >= 0 || len > 0;
+    }
+
+public:
+    CsvScheduleReader(Stream& _stream) : ScheduleReader(_stream) {}
+    bool next(ScheduleRow& row)
+    {
+        while (readLine())
+        {
+            uint32_t currentLine = lineNumber++;
+            bool header = firstLine;
+            firstLine = false;
+            if (lineBuffer[0] == 0 || lineBuffer[0] == '#')
+                continue;
+            if (lineBuffer[0] == 0x01)
+            {
+                lineNumber = currentLine;
+                return fail("baris terlalu panjang");
+            }
+            if (header && strncasecmp(lineBuffer, "hari", 4) == 0)
+                continue;
+
+            char* fields[4];
+            char* p = lineBuffer;
+            int count = 0;
+            while (p && count < 4)
+                p = splitField(p, &fields[count++]);
+            lineNumber = currentLine; // Report the error on the line being parsed
+            if (count < 4)
+                return fail("kolom kurang dari 4");
+            if (!ScheduleIO::parseHari(fields[0], row.hari))
+                return fail("hari tidak valid");
+            if (!ScheduleIO::parseJam(fields[1], row.jadwal))
+                return fail("jam tidak valid");
+            if (!ScheduleIO::copyField(row.nama, fields[2], sizeof(row.nama)))
+                return fail("nama bel terlalu panjang");
+            if (!ScheduleIO::copyField(row.audio, fields[3], sizeof(row.audio)))
+                return fail("path audio terlalu panjang");
+            rowLine = currentLine;
+            lineNumber = currentLine + 1;
+            return true;
+        }
+        return false;
+    }
+};
+
+class JsonScheduleReader : public ScheduleReader
+{
+    static constexpr uint8_t maxDepth = 16;
+    char key[16] = { 0 };
+    char token[SCHEDULE_AUDIO_LEN];
+    uint8_t depth = 0;
+    uint16_t objectMask = 0; // Bit n is set when container at depth n is object
+    bool expectKey = false;
+    uint8_t rowDepth = 0; // Depth of the object currently collecting a bell, 0 when none
+    uint8_t rowFields;
+    enum { HAS_HARI = 1, HAS_JAM = 2, HAS_NAMA = 4, HAS_AUDIO = 8 };
+
+    bool inObject() { return depth > 0 && (objectMask & (1 << depth)); }
+
+    // Read string after the opening quote into token
+    bool readString()
+    {
+        size_t len = 0;
+        int c;
+        while ((c = readChar()) >= 0 && c != '"')
+        {
+            if (c == '\\')
+            {
+                c = readChar();
+                switch (c)
+                {
+                case 'n': c = '\n'; break;
+                case 't': c = '\t'; break;
+                case 'r': c = '\r'; break;
+                case 'b': c = '\b'; break;
+                case 'f': c = '\f'; break;
+                case 'u': // Non-ASCII escape isn't supported by the fonts anyway
+                    for (int i = 0; i < 4; i++)
+                        readChar();
+                    c = '?';
+                    break;
+                case -1: return fail("string tidak ditutup");
+                default: break; // \" \\ \/
+                }
+            }
+            if (len == sizeof(token) - 1)
+                return fail("string terlalu panjang");
+            token[len++] = c;
+        }
+        token[len] = 0;
+        if (c < 0)
+            return fail("string tidak ditutup");
+        return true;
+    }
+
+    // Read number/true/false/null starting with first into token
+    bool readLiteral(char first)
+    {
+        size_t len = 0;
+        token[len++] = first;
+        int c;
+        while ((c = stream.peek()) >= 0 && c != ',' && c != '}' && c != ']' && !isspace(c))
+        {
+            if (len == sizeof(token) - 1)
+                return fail("nilai terlalu panjang");
+            token[len++] = readChar();
+        }
+        token[len] = 0;
+        return true;
+    }
+
+    bool handleValue(ScheduleRow& row)
+    {
+        if (depth == 1 && inObject())
+        {
+            if (strcmp(key, "name") == 0 || strcmp(key, "nama") == 0)
+            {
+                if (!ScheduleIO::copyField(templateName, token, sizeof(templateName)))
+                    return fail("nama template terlalu panjang");
+            }
+            else if (strcmp(key, "tipe") == 0)
+            {
+                if (strcasecmp(token, "harian") == 0 || strcmp(token, "0") == 0)
+                    tipe = 0;
+                else if (strcasecmp(token, "mingguan") == 0 || strcmp(token, "1") == 0)
+                    tipe = 1;
+                else
+                    return fail("tipe tidak valid");
+            }
+            return true;
+        }
+        if (depth != rowDepth)
+            return true;
+        if (strcmp(key, "hari") == 0)
+        {
+            if (!ScheduleIO::parseHari(strcmp(token, "null") == 0 ? "" : token, row.hari))
+                return fail("hari tidak valid");
+            rowFields |= HAS_HARI;
+        }
+        else if (strcmp(key, "jam") == 0)
+        {
+            if (!ScheduleIO::parseJam(token, row.jadwal))
+                return fail("jam tidak valid");
+            rowFields |= HAS_JAM;
+        }
+        else if (strcmp(key, "nama") == 0)
+        {
+            if (!ScheduleIO::copyField(row.nama, token, sizeof(row.nama)))
+                return fail("nama bel terlalu panjang");
+            rowFields |= HAS_NAMA;
+        }
+        else if (strcmp(key, "audio") == 0)
+        {
+            if (!ScheduleIO::copyField(row.audio, token, sizeof(row.audio)))
+                return fail("path audio terlalu panjang");
+            rowFields |= HAS_AUDIO;
+        }
+        return true;
+    }
+
+public:
+    JsonScheduleReader(Stream& _stream) : ScheduleReader(_stream) {}
+    bool next(ScheduleRow& row)
+    {
+        int c;
+        while ((c = readChar()) >= 0)
+        {
+            if (isspace(c))
+                continue;
+            switch (c)
+            {
+            case '{':
+            case '[':
+                if (depth == maxDepth - 1)
+                    return fail("struktur terlalu dalam");
+                depth++;
+                if (c == '{')
+                {
+                    objectMask |= (1 << depth);
+                    expectKey = true;
+                    if (depth >= 2 && rowDepth == 0) // Candidate bell object
+                    {
+                        rowDepth = depth;
+                        rowFields = 0;
+                        row.hari = SCHEDULE_EVERY_DAY;
+                        row.nama[0] = 0;
+                        row.audio[0] = 0;
+                    }
+                }
+                else
+                    objectMask &= ~(1 << depth);
+                break;
+            case '}':
+            case ']':
+                if (depth == 0 || (c == '}') != inObject())
+                    return fail("kurung tidak sesuai");
+                expectKey = false;
+                if (c == '}' && depth == rowDepth)
+                {
+                    rowDepth = 0;
+                    depth--;
+                    if (rowFields & HAS_JAM)
+                    {
+                        rowLine = lineNumber;
+                        return true;
+                    }
+                    break;
+                }
+                depth--;
+                break;
+            case ',':
+                expectKey = inObject();
+                break;
+            case ':':
+                break;
+            case '"':
+                if (!readString())
+                    return false;
+                if (expectKey)
+                {
+                    strncpy(key, token, sizeof(key) - 1);
+                    key[sizeof(key) - 1] = 0;
+                    expectKey = false;
+                }
+                else if (!handleValue(row))
+                    return false;
+                break;
+            default:
+                if (!readLiteral(c) || !handleValue(row))
+                    return false;
+                break;
+            }
+        }
+        if (depth != 0)
+            return fail("file terpotong");
+        return false;
+    }
+};
+
+// Write template jadwal as CSV or JSON, row() must be called in day order for the JSON to be grouped nicely
+class ScheduleWriter
+{
+    Print& out;
+    bool json;
+    bool firstRow = true;
+
+    void writeJsonString(const char* str)
+    {
+        out.print("\"");
+        for (const char* p = str; *p; p++)
+        {
+            char escaped[3] = { '\\', *p, 0 };
+            if (*p == '"' || *p == '\\')
+                out.print(escaped);
+            else if (*p == '\n')
+                out.print("\\n");
+            else
+            {
+                char plain[2] = { *p, 0 };
+                out.print(plain);
+            }
+        }
+        out.print("\"");
+    }
+    void writeCsvField(const char* str)
+    {
+        if (strpbrk(str, ",;\"") == NULL)
+        {
+            out.print(str);
+            return;
+        }
+        out.print("\"");
+        for (const char* p = str; *p; p++)
+        {
+            char plain[2] = { *p, 0 };
+            out.print(*p == '"' ? "\"\"" : plain);
+        }
+        out.print("\"");
+    }
+
+public:
+    ScheduleWriter(Print& _out, bool _json) : out(_out), json(_json) {}
+    void begin(const char* templateName, bool mingguan)
+    {
+        if (json)
+        {
+            out.print("{\"name\":");
+            writeJsonString(templateName);
+            out.printf(",\"tipe\":\"%s\",\"bel\":[", mingguan ? "mingguan" : "harian");
+        }
+        else
+            out.print("hari,jam,nama,audio\n");
+    }
+    void row(int8_t hari, uint16_t jadwal, const char* nama, const char* audio)
+    {
+        const char* hariStr = hari == SCHEDULE_EVERY_DAY ? "Setiap Hari" : ScheduleIO::dayNames[hari];
+        if (json)
+        {
+            out.printf("%s\n{\"hari\":\"%s\",\"jam\":\"%02d:%02d\",\"nama\":", firstRow ? "" : ",", hariStr, jadwal / 100, jadwal % 100);
+            writeJsonString(nama);
+            out.print(",\"audio\":");
+            writeJsonString(audio);
+            out.print("}");
+        }
+        else
+        {
+            out.printf("%s,%02d:%02d,", hariStr, jadwal / 100, jadwal % 100);
+            writeCsvField(nama);
+            out.print(",");
+            writeCsvField(audio);
+            out.print("\n");
+        }
+        firstRow = false;
+    }
+    void end()
+    {
+        if (json)
+            out.print("\n]}\n");
+    }
+};
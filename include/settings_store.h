@@ -0,0 +1,193 @@
+#pragma once
+#include <Arduino.h>
+#include <Preferences.h>
+#include <stopwatch.h>
+
+// Where the settings bytes actually live, NVS on the device and RAM for host tests or as fallback
+class SettingsBackend
+{
+public:
+    virtual ~SettingsBackend() {}
+    virtual bool begin() = 0;
+    // Return the number of bytes read, 0 when key doesn't exist or the stored size is different
+    virtual size_t load(const char* key, void* data, size_t len) = 0;
+    virtual bool store(const char* key, const void* data, size_t len) = 0;
+};
+
+// Settings stored on NVS partition with Preferences library, key must be 15 characters or less
+class NvsSettingsBackend : public SettingsBackend
+{
+    Preferences prefs;
+    const char* nameSpace;
+
+public:
+    NvsSettingsBackend(const char* _nameSpace) : nameSpace(_nameSpace) {}
+    bool begin() { return prefs.begin(nameSpace, false); }
+    size_t load(const char* key, void* data, size_t len)
+    {
+        if (!prefs.isKey(key) || prefs.getBytesLength(key) != len)
+            return 0;
+        return prefs.getBytes(key, data, len);
+    }
+    bool store(const char* key, const void* data, size_t len) { return prefs.putBytes(key, data, len) == len; }
+};
+
+// Settings stored on RAM only, lost on reset
+template <size_t maxEntries = 8, size_t maxLen = 1024>
+class MemorySettingsBackend : public SettingsBackend
+{
+    struct Slot
+    {
+        const char* key;
+        size_t len;
+        uint8_t data[maxLen];
+    } slots[maxEntries];
+    size_t slotCount = 0;
+
+    Slot* find(const char* key)
+    {
+        for (size_t i = 0; i < slotCount; i++)
+            if (strcmp(slots[i].key, key) == 0)
+                return &slots[i];
+        return NULL;
+    }
+
+public:
+    uint32_t storeCount = 0; // Number of store() call that reach the backend
+    uint32_t loadCount = 0;
+    bool begin() { return true; }
+    size_t load(const char* key, void* data, size_t len)
+    {
+        loadCount++;
+        Slot* slot = find(key);
+        if (!slot || slot->len != len)
+            return 0;
+        memcpy(data, slot->data, len);
+        return len;
+    }
+    bool store(const char* key, const void* data, size_t len)
+    {
+        if (len > maxLen)
+            return false;
+        Slot* slot = find(key);
+        if (!slot)
+        {
+            if (slotCount == maxEntries)
+                return false;
+            slot = &slots[slotCount++];
+            slot->key = key;
+        }
+        slot->len = len;
+        memcpy(slot->data, data, len);
+        storeCount++;
+        return true;
+    }
+};
+
+// Typed settings cache, the value lives on the bound variable and is written back to the backend
+// only after it stay unchanged for commitDelay, so repeated changes only cost one write
+class SettingsStore
+{
+public:
+    static constexpr uint8_t maxEntries = 8;
+
+private:
+    struct Entry
+    {
+        const char* key;
+        void* data;
+        size_t len;
+        bool loaded;
+        bool dirty;
+        uint32_t dirtyMillis;
+    } entries[maxEntries];
+    uint8_t entryCount = 0;
+    SettingsBackend* backend;
+    uint32_t commitDelay;
+    Stopwatch::Clock clock;
+    bool ready = false;
+
+    bool commit(Entry& entry)
+    {
+        if (!ready || !backend->store(entry.key, entry.data, entry.len))
+            return false;
+        entry.dirty = false;
+        writeCount++;
+        return true;
+    }
+
+public:
+    uint32_t writeCount = 0;     // Writes issued to the backend
+    uint32_t coalescedCount = 0; // Changes merged into a pending write
+
+    SettingsStore(SettingsBackend* _backend, uint32_t _commitDelay = 2000, Stopwatch::Clock _clock = Stopwatch::defaultClock)
+        : backend(_backend), commitDelay(_commitDelay), clock(_clock) {}
+    bool begin() { return ready = backend->begin(); }
+    bool isReady() { return ready; }
+
+    // Bind variable to key, return the id used for the other calls or -1 when full
+    template <typename T>
+    int bind(const char* key, T& value) { return bindRaw(key, &value, sizeof(T)); }
+    int bindRaw(const char* key, void* data, size_t len)
+    {
+        if (entryCount == maxEntries)
+            return -1;
+        entries[entryCount] = { key, data, len, false, false, 0 };
+        return entryCount++;
+    }
+
+    // Read the bound variable from backend once, later call return the cached value on the variable
+    bool load(int id)
+    {
+        if (id < 0 || id >= entryCount)
+            return false;
+        Entry& entry = entries[id];
+        if (entry.loaded || entry.dirty)
+            return true;
+        if (!ready || backend->load(entry.key, entry.data, entry.len) != entry.len)
+            return false;
+        entry.loaded = true;
+        return true;
+    }
+
+    // Read every bound variable in one pass at boot, return the count loaded. Later load() are served from cache
+    uint8_t loadAll()
+    {
+        uint8_t count = 0;
+        for (uint8_t i = 0; i < entryCount; i++)
+            count += load(i);
+        return count;
+    }
+
+    // Bound variable is changed, schedule the write back
+    void touch(int id)
+    {
+        if (id < 0 || id >= entryCount)
+            return;
+        Entry& entry = entries[id];
+        if (entry.dirty)
+            coalescedCount++;
+        entry.dirty = true;
+        entry.loaded = true;
+        entry.dirtyMillis = clock();
+    }
+
+    // Write back the entries that stay unchanged for commitDelay, must be called periodically
+    void loop()
+    {
+        uint32_t now = clock();
+        for (uint8_t i = 0; i < entryCount; i++)
+            if (entries[i].dirty && now - entries[i].dirtyMillis >= commitDelay)
+                commit(entries[i]);
+    }
+
+    // Write back every pending entries now, used before restart
+    bool flush()
+    {
+        bool ok = true;
+        for (uint8_t i = 0; i < entryCount; i++)
+            if (entries[i].dirty)
+                ok &= commit(entries[i]);
+        return ok;
+    }
+};
@@ -1,7 +1,14 @@
+#pragma once
 #include <Arduino.h>
 
 class Stopwatch
 {
+public:
+    // Millisecond time source, millis() on the device, a virtual clock in the schedule simulator
+    typedef uint32_t (*Clock)();
+    static uint32_t defaultClock() { return millis(); }
+
+private:
     typedef enum
     {
         RESET,
@@ -10,16 +17,17 @@ class Stopwatch
     } State;
     uint32_t startTime, stopTime;
     State state = RESET;
+    Clock clock;
 
 public:
-    Stopwatch() { reset(); }
+    Stopwatch(Clock _clock = defaultClock) : clock(_clock) { reset(); }
     bool isRunning() { return state == RUNNING; }
     void start()
     {
         if (state == RESET || state == STOPPED)
         {
             state = RUNNING;
-            uint32_t t = millis();
+            uint32_t t = clock();
             startTime += t - stopTime;
             stopTime = t;
         }
@@ -29,7 +37,7 @@ public:
         if (state == RUNNING)
         {
             state = STOPPED;
-            stopTime = millis();
+            stopTime = clock();
         }
     }
     void reset()
@@ -40,7 +48,7 @@ public:
     uint32_t elapsed() const
     {
         if (state == RUNNING)
-            return millis() - startTime;
+            return clock() - startTime;
         return stopTime - startTime;
     }
 };
\ No newline at end of file
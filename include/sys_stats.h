@@ -0,0 +1,72 @@
+#pragma once
+#include <Arduino.h>
+#include <stdarg.h>
+
+#define SYS_STATS_MAX_TASKS 24 // Tasks beyond this are not reported
+
+/*
+Telemetry for the serial console, one record per line for the fleet scripts :
+  <record> key=value key=value ...
+Every line is formatted into a static buffer and written as is, Serial.printf would allocate on lines
+longer than 64 bytes. Only loop() call these, so the static buffers are never used concurrently.
+*/
+
+static char sysStatsLine[192];
+
+inline void sys_stats_printf(const char* fmt, ...)
+{
+    va_list args;
+    va_start(args, fmt);
+    int len = vsnprintf(sysStatsLine, sizeof(sysStatsLine), fmt, args);
+    va_end(args);
+    if (len > 0)
+        Serial.write((const uint8_t*)sysStatsLine, len < (int)sizeof(sysStatsLine) ? len : sizeof(sysStatsLine) - 1);
+}
+
+inline char sys_stats_taskState(eTaskState state)
+{
+    switch (state) {
+    case eRunning: return 'X';
+    case eReady: return 'R';
+    case eBlocked: return 'B';
+    case eSuspended: return 'S';
+    case eDeleted: return 'D';
+    default: return '?';
+    }
+}
+
+// "task" record per task. stack_free is the stack high-water mark in bytes (ESP-IDF stack sizes are in bytes).
+// cpu_us and cpu_pm (per mille of one core since boot) are only available when FreeRTOS run time stats are
+// enabled. Uses uxTaskGetSystemState() on a static array instead of vTaskGetRunTimeStats(), which allocates
+inline void sys_stats_tasks()
+{
+    static TaskStatus_t tasks[SYS_STATS_MAX_TASKS];
+    uint32_t totalRunTime = 0;
+    UBaseType_t count = uxTaskGetSystemState(tasks, SYS_STATS_MAX_TASKS, &totalRunTime);
+    if (count == 0) {
+        sys_stats_printf("task error=too_many total=%u\n", uxTaskGetNumberOfTasks());
+        return;
+    }
+    for (UBaseType_t i = 0; i < count; i++) {
+        TaskStatus_t& task = tasks[i];
+#if configTASKLIST_INCLUDE_COREID
+        int core = task.xCoreID == tskNO_AFFINITY ? -1 : task.xCoreID;
+#else
+        int core = -1;
+#endif
+        sys_stats_printf("task name=%s core=%d prio=%u state=%c stack_free=%u", task.pcTaskName, core, task.uxCurrentPriority,
+            sys_stats_taskState(task.eCurrentState), task.usStackHighWaterMark);
+#if configGENERATE_RUN_TIME_STATS
+        sys_stats_printf(" cpu_us=%lu cpu_pm=%lu", task.ulRunTimeCounter, totalRunTime ? (uint32_t)((uint64_t)task.ulRunTimeCounter * 1000 / totalRunTime) : 0);
+#endif
+        Serial.write('\n');
+    }
+}
+
+// "heap" record of the 8 bit capable heap, largest is the biggest block that can still be allocated
+inline void sys_stats_heap()
+{
+    sys_stats_printf("heap free=%u min=%u largest=%u internal_free=%u\n", heap_caps_get_free_size(MALLOC_CAP_8BIT),
+        heap_caps_get_minimum_free_size(MALLOC_CAP_8BIT), heap_caps_get_largest_free_block(MALLOC_CAP_8BIT),
+        heap_caps_get_free_size(MALLOC_CAP_INTERNAL));
+}
@@ -0,0 +1,108 @@
+#pragma once
+#include <Arduino.h>
+#include <RTClib.h>
+#include <esp_timer.h>
+
+#define WALLCLOCK_RESYNC_PERIOD 600000 // Default time between RTC resyncs (ms)
+#define WALLCLOCK_EDGE_POLL 10 // RTC poll period while looking for the seconds edge (ms)
+#define WALLCLOCK_MAX_DRIFT_PPB 200000 // Correction limit, far more than a crystal drift
+
+// Wall clock kept from esp_timer between RTC resyncs. The RTC is only read by the I2C bus task, which call
+// sync() at the edge of an RTC second, so the local time is aligned to a few ms instead of a whole second.
+// Every sync compare the local time against the RTC and fold the difference into the rate correction.
+// now() hand out a broken-down DateTime cached until the second change
+class WallClock
+{
+    portMUX_TYPE mux = portMUX_INITIALIZER_UNLOCKED;
+    uint32_t baseEpoch = 0; // Unix time at baseUs
+    int64_t baseUs = 0;
+    int32_t driftPpb = 0; // Rate correction, positive when esp_timer is slow against the RTC
+    bool slept = false; // Light sleep since the base, esp_timer ran from the RC slow clock for a part of it
+    uint32_t cachedEpoch = 0;
+    DateTime cachedTime;
+
+    int64_t localMs(int64_t us)
+    {
+        int64_t elapsed = us - baseUs;
+        return (int64_t)baseEpoch * 1000 + (elapsed + elapsed * driftPpb / 1000000000) / 1000;
+    }
+
+public:
+    uint32_t syncs = 0;
+    int32_t lastOffsetMs = 0; // Local minus RTC time at the last edge sync
+    uint32_t lastSyncMillis = 0;
+    bool edgeSynced = false; // False until the first edge sync, local time may be off by up to a second
+
+    // Unix time in ms
+    int64_t nowMs()
+    {
+        int64_t us = esp_timer_get_time();
+        portENTER_CRITICAL(&mux);
+        int64_t ms = localMs(us);
+        portEXIT_CRITICAL(&mux);
+        return ms;
+    }
+
+    DateTime now()
+    {
+        uint32_t epoch = nowMs() / 1000;
+        portENTER_CRITICAL(&mux);
+        bool cached = epoch == cachedEpoch;
+        DateTime t = cachedTime;
+        portEXIT_CRITICAL(&mux);
+        if (cached)
+            return t;
+        t = DateTime(epoch);
+        portENTER_CRITICAL(&mux);
+        cachedEpoch = epoch;
+        cachedTime = t;
+        portEXIT_CRITICAL(&mux);
+        return t;
+    }
+
+    // RTC time read at an unknown point of its second (boot, after adjust), no drift measurement
+    void set(uint32_t rtcEpoch)
+    {
+        int64_t us = esp_timer_get_time();
+        portENTER_CRITICAL(&mux);
+        baseEpoch = rtcEpoch;
+        baseUs = us;
+        cachedEpoch = 0;
+        slept = false;
+        portEXIT_CRITICAL(&mux);
+        edgeSynced = false;
+        lastSyncMillis = millis();
+    }
+
+    // RTC second rtcEpoch started at esp_timer time edgeUs
+    void sync(uint32_t rtcEpoch, int64_t edgeUs)
+    {
+        portENTER_CRITICAL(&mux);
+        int32_t offset = localMs(edgeUs) - (int64_t)rtcEpoch * 1000;
+        int64_t elapsedMs = (edgeUs - baseUs) / 1000;
+        // Previous base was an edge too and esp_timer stayed on the crystal, the offset is the drift since then
+        if (edgeSynced && !slept && elapsedMs > 10000) {
+            int64_t ppb = driftPpb + (int64_t)-offset * 1000000000 / elapsedMs;
+            driftPpb = ppb > WALLCLOCK_MAX_DRIFT_PPB ? WALLCLOCK_MAX_DRIFT_PPB : ppb < -WALLCLOCK_MAX_DRIFT_PPB ? -WALLCLOCK_MAX_DRIFT_PPB : ppb;
+        }
+        baseEpoch = rtcEpoch;
+        baseUs = edgeUs;
+        cachedEpoch = 0;
+        slept = false;
+        portEXIT_CRITICAL(&mux);
+        lastOffsetMs = offset;
+        edgeSynced = true;
+        lastSyncMillis = millis();
+        syncs++;
+    }
+
+    // Called after a light sleep, the next sync only correct the time and don't learn the drift from it
+    void sleepHappened()
+    {
+        portENTER_CRITICAL(&mux);
+        slept = true;
+        portEXIT_CRITICAL(&mux);
+    }
+
+    int32_t drift() { return driftPpb; }
+};
@@ -38,7 +38,7 @@ namespace lgfx
     uint8_t r = 0, g = 0, b = 0;
 
     // GGGBBBBB RRRRRGGG
-    if (_write_depth = color_depth_t::rgb565_2Byte)
+    if (_write_depth == color_depth_t::rgb565_2Byte)
     {
       b = (uint8_t)((rawcolor >> 8) & 0b11111);
       g = (uint8_t)((((rawcolor >> 10) & 0b111000)) | (rawcolor & 0b111));
@@ -49,17 +49,17 @@ namespace lgfx
       // write 'two bytes at once'
       *((unsigned short*)(_fbp + pix_offset)) = c;
     }
-    // BBBBBBBB GGGGGGGG RRRRRRRR
-    else if (_write_depth = color_depth_t::rgb888_3Byte)
+    // RRRRRRRR GGGGGGGG BBBBBBBB (bgr888_t, same byte order as writePixels)
+    else if (_write_depth == color_depth_t::rgb888_3Byte)
     {
-      b = (uint8_t)((rawcolor >> 16) & 0xff);
-      g = (uint8_t)((rawcolor >> 8) & 0xff);
       r = (uint8_t)((rawcolor >> 0) & 0xff);
+      g = (uint8_t)((rawcolor >> 8) & 0xff);
+      b = (uint8_t)((rawcolor >> 16) & 0xff);
 
       pix_offset = x * 3 + y * _fix_info.line_length;
-      *((char*)(_fbp + pix_offset)) = b;
+      *((char*)(_fbp + pix_offset)) = r;
       *((char*)(_fbp + pix_offset + 1)) = g;
-      *((char*)(_fbp + pix_offset + 2)) = r;
+      *((char*)(_fbp + pix_offset + 2)) = b;
     }
   }
 
@@ -83,14 +83,17 @@ namespace lgfx
 
   Panel_fb::~Panel_fb(void)
   {
-    // unmap fb file from memory
-    munmap(_fbp, _screensize);
-    // reset the display mode
-    if (ioctl(_fbfd, FBIOPUT_VSCREENINFO, &_fix_info)) {
-        printf("Error re-setting variable information.\n");
+    if (_fbp)
+    {
+      // unmap fb file from memory
+      munmap(_fbp, _screensize);
+      // reset the display mode
+      if (ioctl(_fbfd, FBIOPUT_VSCREENINFO, &_fix_info)) {
+          printf("Error re-setting variable information.\n");
+      }
+      // close fb file
+      close(_fbfd);
     }
-    // close fb file    
-    close(_fbfd);
 
     memset(&_fix_info, 0, sizeof(_fix_info));
     memset(&_var_info, 0, sizeof(_fix_info));
@@ -109,14 +112,14 @@ namespace lgfx
     _fbfd = open("/dev/fb0", O_RDWR);
     if (_fbfd == -1) {
         printf("Error: cannot open framebuffer device.\n");
-        return 1;
+        return false;
     }
     // printf("The framebuffer device was opened successfully.\n");
 
     // Get variable screen information
     if (ioctl(_fbfd, FBIOGET_VSCREENINFO, &_var_info)) {
         printf("Error reading variable information.\n");
-        return 1;
+        return false;
     }
     // printf("%dx%d, %dbpp\n", _var_info.xres, _var_info.yres, _var_info.bits_per_pixel);
 
@@ -126,7 +129,7 @@ namespace lgfx
     // Get fixed screen information
     if (ioctl(_fbfd, FBIOGET_FSCREENINFO, &_fix_info)) {
         printf("Error reading fixed information.\n");
-        return 1;
+        return false;
     }
 
     // Figure out the size of the screen in bytes
@@ -136,7 +139,8 @@ namespace lgfx
     _fbp = (char *)mmap(0, _screensize, PROT_READ | PROT_WRITE, MAP_SHARED, _fbfd, 0);
     if((intptr_t)_fbp == -1) {
         perror("Error: failed to map framebuffer device to memory");
-        return 1;
+        _fbp = nullptr;
+        return false;
     }
     memset(_fbp, 0, _screensize);
 
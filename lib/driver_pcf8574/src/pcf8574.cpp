@@ -1,35 +1,92 @@
 #include <pcf8574.h>
 
+void pcf8574WireBus::writeByte(uint8_t address, uint8_t data)
+{
+    wire->beginTransmission(address);
+    wire->write(data);
+    wire->endTransmission(true);
+}
+
+uint8_t pcf8574WireBus::readByte(uint8_t address)
+{
+    uint8_t data;
+    wire->requestFrom(address,sizeof(uint8_t));
+    data = wire->read();
+    wire->endTransmission(true);
+    return data;
+}
+
 /* Initialize PCF8574 with specific address and i2c port
 Must be called after Wire.begin()
 */
-void pcf8574::init(uint8_t _addr)
+void pcf8574::init(uint8_t _addr, TwoWire& _wire)
+{
+    wireBus.wire = &_wire;
+    init(_addr, wireBus);
+}
+
+// Initialize PCF8574 on any bus, the bus must outlive the driver
+void pcf8574::init(uint8_t _addr, pcf8574Bus& _bus)
 {
     address = _addr;
+    bus = &_bus;
     writeByte(0x00);
 }
 
 void pcf8574::writeByte(uint8_t data)
 {
-    Wire.beginTransmission(address);
-    Wire.write(data);
-    Wire.endTransmission(true);
-    ioRegister = data;
+    bus->writeByte(address, data);
+    transactions++;
+    ioRegister = staged = data;
+    stagedCount = 0;
 }
 
 void pcf8574::write(uint8_t pin, bool data)
 {
-    ioRegister = data ? ioRegister | (1 << pin) : ioRegister & ~(1 << pin);
-    return writeByte(ioRegister);
+    stage(pin, data);
+    commit();
+}
+
+void pcf8574::stage(uint8_t pin, bool data)
+{
+    if (stagedCount == 0)
+        staged = ioRegister;
+    staged = data ? staged | (1 << pin) : staged & ~(1 << pin);
+    stagedCount++;
+}
+
+void pcf8574::stageByte(uint8_t data)
+{
+    staged = data;
+    stagedCount++;
+}
+
+bool pcf8574::pending()
+{
+    return stagedCount && staged != ioRegister;
+}
+
+bool pcf8574::commit()
+{
+    if (stagedCount == 0)
+        return false;
+    if (staged == ioRegister) {
+        avoided += stagedCount;
+        stagedCount = 0;
+        return false;
+    }
+    avoided += stagedCount - 1;
+    writeByte(staged);
+    return true;
 }
 
 uint8_t pcf8574::readByte()
 {
-    uint8_t data;
-    Wire.requestFrom(address,sizeof(uint8_t));
-    data = Wire.read();
-    Wire.endTransmission(true);
+    uint8_t data = bus->readByte(address);
+    transactions++;
     ioRegister = data;
+    if (stagedCount == 0)
+        staged = data;
     return data;
 }
 
@@ -48,4 +105,4 @@ bool pcf8574::readFast(uint8_t pin)
 uint8_t pcf8574::readByteFast()
 {
     return ioRegister;
-}
\ No newline at end of file
+}
@@ -12,6 +12,26 @@
 #include <Wire.h>
 #include <Arduino.h>
 
+// Byte transfers to the expander, the driver only need these two. Implemented on TwoWire by pcf8574WireBus,
+// and by a fake bus on the host tests
+class pcf8574Bus
+{
+public:
+    virtual ~pcf8574Bus(){
+    }
+    virtual void writeByte(uint8_t address, uint8_t data) = 0;
+    virtual uint8_t readByte(uint8_t address) = 0;
+};
+
+class pcf8574WireBus : public pcf8574Bus
+{
+public:
+    TwoWire* wire = &Wire;
+
+    void writeByte(uint8_t address, uint8_t data);
+    uint8_t readByte(uint8_t address);
+};
+
 class pcf8574
 {
 public:
@@ -19,18 +39,32 @@ public:
     }
     ~pcf8574(){
     }
-    void init(uint8_t _addr); // Must be called after i2c_driver_install()
+    void init(uint8_t _addr, TwoWire& _wire = Wire); // Must be called after i2c_driver_install()
+    void init(uint8_t _addr, pcf8574Bus& _bus);
 
     void writeByte(uint8_t data);
     void write(uint8_t pin,bool data);
 
+    // Shadow register, stage any number of pin changes then send them with one commit()
+    void stage(uint8_t pin, bool data);
+    void stageByte(uint8_t data);
+    bool pending(); // Staged value differ from the port
+    bool commit(); // Write the staged value, skipped when it's the same as the port. Return true if written
+
     uint8_t readByte();
     bool read(uint8_t pin);
 
     bool readFast(uint8_t pin); // Read value from ioRegister variable instead of read from pcf8574
     uint8_t readByteFast(); // Read value from ioRegister variable instead of read from pcf8574
+
+    uint32_t transactions = 0; // I2C transactions issued
+    uint32_t avoided = 0; // Staged changes that didn't need their own transaction
 private:
     uint8_t ioRegister; // Variable to store the value of the byte of the IO port
+    uint8_t staged; // Value sent by the next commit()
+    uint16_t stagedCount = 0; // Changes staged since the last commit()
     uint8_t address;
+    pcf8574WireBus wireBus;
+    pcf8574Bus* bus = &wireBus;
 };
-#endif
\ No newline at end of file
+#endif
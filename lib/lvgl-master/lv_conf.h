@@ -51,7 +51,11 @@
 #define LV_MEM_CUSTOM 0
 #if LV_MEM_CUSTOM == 0
     /*Size of the memory available for `lv_mem_alloc()` in bytes (>= 2kB)*/
+#ifdef JAMBEL_HOST
+    #define LV_MEM_SIZE (128U * 1024U)         /*Host build, objects are bigger with 64 bit pointers*/
+#else
     #define LV_MEM_SIZE (64U * 1024U)          /*[bytes]*/
+#endif
 
     /*Set an address for the memory pool instead of allocating it as a normal array. Can be in external SRAM too.*/
     #define LV_MEM_ADR 0     /*0: unused*/
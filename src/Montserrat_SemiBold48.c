@@ -1,7 +1,7 @@
 /*******************************************************************************
  * Size: 48 px
- * Bpp: 4
- * Opts: 
+ * Bpp: 8
+ * Opts: tools/font_subset.py --chars "0123456789:" --bpp 8
  ******************************************************************************/
 
 #include <lvgl.h>
@@ -19,609 +19,1186 @@
 /*Store the image of the glyphs*/
 static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
     /* U+0030 "0" */
-    0x0, 0x0, 0x0, 0x0, 0x3, 0x8c, 0xef, 0xfe,
-    0xc9, 0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5d, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xe7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x2, 0xdf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x40,
-    0x0, 0x0, 0x0, 0x1, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x30, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xff, 0xff, 0xea, 0x77,
-    0x8d, 0xff, 0xff, 0xff, 0xfe, 0x10, 0x0, 0x0,
-    0x6f, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0, 0x4,
-    0xdf, 0xff, 0xff, 0xfa, 0x0, 0x0, 0xe, 0xff,
-    0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x1, 0xdf,
-    0xff, 0xff, 0xf3, 0x0, 0x6, 0xff, 0xff, 0xff,
-    0x60, 0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff,
-    0xff, 0xa0, 0x0, 0xcf, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff,
-    0x10, 0x1f, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1f, 0xff, 0xff, 0xf5, 0x5,
-    0xff, 0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xbf, 0xff, 0xff, 0x90, 0x8f, 0xff,
-    0xff, 0xd0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0xfd, 0xa, 0xff, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xff, 0xf0, 0xcf, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff, 0xff,
-    0xff, 0x1d, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xf2,
-    0xef, 0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0x2e, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xf2, 0xdf, 0xff, 0xff,
-    0x70, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xff, 0xff, 0xff, 0x2c, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xf1, 0xaf, 0xff, 0xff, 0xa0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff,
-    0x8, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xd0, 0x5f,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xf9, 0x1, 0xff, 0xff,
-    0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xff, 0xff, 0xff, 0x50, 0xc, 0xff, 0xff, 0xfd,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8f, 0xff,
-    0xff, 0xf1, 0x0, 0x6f, 0xff, 0xff, 0xf6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xfa,
-    0x0, 0x0, 0xef, 0xff, 0xff, 0xf3, 0x0, 0x0,
-    0x0, 0x0, 0x1d, 0xff, 0xff, 0xff, 0x30, 0x0,
-    0x6, 0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x3d, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xff, 0xfe, 0xa7, 0x78, 0xdf, 0xff,
-    0xff, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x1d, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf3, 0x0, 0x0, 0x0, 0x0, 0x2d, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf4, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1b, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xd3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xfe, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x38, 0xce, 0xff, 0xec, 0x95,
-    0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x33, 0x88, 0xcc, 0xee, 0xff, 0xff, 0xee,
+    0xcc, 0x99, 0x55, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x55, 0xdd, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xee, 0x77, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x11,
+    0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd,
+    0x33, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x22, 0xdd, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x44, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x11,
+    0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x33, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xbb, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xee, 0xaa, 0x77, 0x77,
+    0x88, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xee, 0x11, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x66, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x77, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x44,
+    0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaa,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xee, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x33, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x11, 0xdd, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x33, 0x0, 0x0,
+    0x0, 0x66, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x66, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x22, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xaa, 0x0, 0x0, 0x0, 0xcc, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xdd, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x88, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x11, 0x0, 0x11, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x66, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x11, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0x0, 0x55,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x11, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xbb, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x99, 0x0, 0x88, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xdd, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x88, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd,
+    0x0, 0xaa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaa,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x55, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0xcc, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x88, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x33, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x11, 0xdd, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x77, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22,
+    0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0x66, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x11, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x22, 0xee, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x66, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x11, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x22, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x77, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x22,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0xcc,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x88, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x33, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x11, 0xaa, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xaa, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x55, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x0, 0x88, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x88, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xdd, 0x0, 0x55, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x11, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xcc, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x99, 0x0, 0x11, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x66, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x11,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0x0,
+    0x0, 0xcc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x88, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x11, 0x0, 0x0, 0x66, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x66, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaa,
+    0x0, 0x0, 0x0, 0x0, 0xee, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x33, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x11, 0xdd, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x33, 0x0, 0x0, 0x0,
+    0x0, 0x66, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x77, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x33, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xaa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbb,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee,
+    0xaa, 0x77, 0x77, 0x88, 0xdd, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xee, 0x11, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x11, 0xdd, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x33, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x22, 0xdd, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x44, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x11, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xdd, 0x33, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x55,
+    0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xee, 0x77, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x33, 0x88,
+    0xcc, 0xee, 0xff, 0xff, 0xee, 0xcc, 0x99, 0x55,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
 
     /* U+0031 "1" */
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x9f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x9f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfb, 0x9f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfb, 0x9f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfb, 0x24, 0x44, 0x44, 0x4a, 0xff,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xfb, 0x0, 0x0,
-    0x0, 0x8, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xfb, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xfb, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xfb, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xfb,
-    0x0, 0x0, 0x0, 0x8, 0xff, 0xff, 0xfb, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xfb,
+    0x99, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0x99, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xbb, 0x99, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xbb, 0x99, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb,
+    0x99, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0x22, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0xaa, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xbb, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x88, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xbb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x88, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x88,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x88, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xbb, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x88, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xbb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x88, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x88,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x88, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xbb, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x88, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xbb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x88, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x88,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x88, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xbb, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x88, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xbb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x88, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x88,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x88, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xbb, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x88, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xbb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x88, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x88,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x88, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xbb, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x88, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xbb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x88, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x88,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x88, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xbb, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x88, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xbb, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x88, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x88,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x88, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xbb,
 
     /* U+0032 "2" */
-    0x0, 0x0, 0x0, 0x3, 0x7a, 0xde, 0xff, 0xfd,
-    0xb8, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd5,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xef, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x10, 0x0,
-    0x0, 0x9, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfc, 0x10, 0x0, 0xa, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfa, 0x0, 0x5, 0xff, 0xff, 0xff, 0xff,
-    0xda, 0x77, 0x79, 0xdf, 0xff, 0xff, 0xff, 0xf4,
-    0x0, 0x6, 0xff, 0xff, 0xfa, 0x20, 0x0, 0x0,
-    0x0, 0x3d, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x3,
-    0xef, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x1, 0xa3, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff,
-    0xf1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2f, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xc0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff, 0xff,
-    0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x5, 0xff, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xff, 0xd0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff,
-    0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x5, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6, 0xff,
-    0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x8, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x9, 0xff, 0xff,
-    0xff, 0xe3, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xa, 0xff, 0xff, 0xff, 0xe2, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xa,
-    0xff, 0xff, 0xff, 0xe2, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff,
-    0xd1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xff, 0xd1, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1c, 0xff,
-    0xff, 0xff, 0xc1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1d, 0xff, 0xff, 0xff, 0xe5,
-    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x20,
-    0x1d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf7, 0x5, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x70, 0x5f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
-    0x5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x5f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf7,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x33,
+    0x77, 0xaa, 0xdd, 0xee, 0xff, 0xff, 0xff, 0xdd,
+    0xbb, 0x88, 0x33, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x77, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0x55,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x55, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xbb, 0x11, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x99, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcc,
+    0x11, 0x0, 0x0, 0x0, 0x0, 0xaa, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xaa, 0x0, 0x0, 0x0, 0x55,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xdd, 0xaa, 0x77, 0x77, 0x77, 0x99, 0xdd, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x44,
+    0x0, 0x0, 0x0, 0x66, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xaa, 0x22, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x33, 0xdd, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xaa, 0x0, 0x0, 0x0, 0x0, 0x33,
+    0xee, 0xff, 0xff, 0x44, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x11, 0xee,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x11, 0xaa, 0x33, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x77, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x11, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x33, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x22, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x11,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x44, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x77, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xcc, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0x88,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x88, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x11, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x55, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x88, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x44,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x55, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x22, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x55, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x44, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x66, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x77,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x44,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x88, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x44, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x99, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xee, 0x33, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xaa, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xee, 0x22, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaa,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0x22,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xdd, 0x11, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xcc, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xdd, 0x11, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x11, 0xcc, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xcc, 0x11, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x11, 0xdd,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0x55,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x22, 0x0,
+    0x11, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x77, 0x0, 0x55, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x77, 0x0, 0x55, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x77,
+    0x0, 0x55, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x77, 0x0, 0x55, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x77,
 
     /* U+0033 "3" */
-    0x5, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x90, 0x5, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x90, 0x5, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90, 0x5,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x90, 0x5, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x40, 0x1, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
-    0x44, 0xaf, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4, 0xff, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xfa, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0xef,
-    0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1d, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xcf, 0xff, 0xff, 0xe1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xfe,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x9f, 0xff, 0xff, 0xf3, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0xe9, 0x51, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xa2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x25, 0x9f, 0xff, 0xff, 0xff, 0xd0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0xdf, 0xff, 0xff, 0xf5, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1f, 0xff, 0xff,
-    0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x9, 0xff, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x5,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xfe, 0x0, 0x65, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xff, 0xfb, 0x1, 0xff, 0xa2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x8f, 0xff, 0xff, 0xf7, 0x8,
-    0xff, 0xff, 0xa4, 0x0, 0x0, 0x0, 0x0, 0x2a,
-    0xff, 0xff, 0xff, 0xf1, 0x1f, 0xff, 0xff, 0xff,
-    0xfb, 0x97, 0x77, 0x9c, 0xff, 0xff, 0xff, 0xff,
-    0x80, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfd, 0x0, 0x7f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xd1, 0x0, 0x2, 0xaf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x10, 0x0,
-    0x0, 0x2, 0x8e, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x26, 0xac, 0xef, 0xff, 0xed, 0xa7, 0x20, 0x0,
-    0x0, 0x0,
+    0x0, 0x55, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x99, 0x0, 0x0, 0x55, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x99, 0x0, 0x0, 0x55, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x99, 0x0, 0x0, 0x55,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x99, 0x0,
+    0x0, 0x55, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x44, 0x0, 0x0, 0x11, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0xaa, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x66, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x44, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x88, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x33, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xaa, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x22, 0xee, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xbb, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x11, 0xdd,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xcc, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xcc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0x11,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee,
+    0x22, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x99, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x33, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x77, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xee, 0x99, 0x55, 0x11, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xbb, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xaa, 0x22, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbb,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x66, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x77,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xbb, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x44, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x22, 0x55, 0x99, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xdd, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x22,
+    0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x11, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xaa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x99, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xdd, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x55,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x55, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x77, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xee, 0x0, 0x0, 0x66, 0x55, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xdd, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xbb, 0x0, 0x11, 0xff, 0xff,
+    0xaa, 0x22, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x88, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x77, 0x0, 0x88,
+    0xff, 0xff, 0xff, 0xff, 0xaa, 0x44, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x22, 0xaa,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x11,
+    0x11, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xbb, 0x99, 0x77, 0x77, 0x77, 0x99, 0xcc,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x88, 0x0, 0xaa, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xdd, 0x0, 0x0, 0x77, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xdd, 0x11, 0x0, 0x0, 0x0, 0x22,
+    0xaa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xbb, 0x11, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x22, 0x88, 0xee, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xcc, 0x44, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x22, 0x66, 0xaa, 0xcc, 0xee, 0xff, 0xff, 0xff,
+    0xee, 0xdd, 0xaa, 0x77, 0x22, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0,
 
     /* U+0034 "4" */
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x3f, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xdf, 0xff, 0xff, 0xb0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xfe, 0x10, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x7f,
-    0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbf, 0xff,
-    0xff, 0xe1, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xff, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xef, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xfe,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x1e, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xbf, 0xff, 0xff, 0xf2, 0x0,
-    0x0, 0xa, 0xdd, 0xdd, 0xd1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0x50, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4f, 0xff, 0xff, 0xf9, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x1, 0xef, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x8f, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x1e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf1,
-    0x14, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
-    0x44, 0x4f, 0xff, 0xff, 0xf6, 0x44, 0x44, 0x40,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xf, 0xff, 0xff, 0xf1, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x33, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x77,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x11,
+    0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbb,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0x11, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x77, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x44, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x33, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x88, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x11, 0xee, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xcc, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xbb, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xee, 0x11, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x77, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x44, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x33, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x88, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x11, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xcc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee,
+    0x22, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x77, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x33,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x99, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x11, 0xee,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xcc, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbb, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaa, 0xdd, 0xdd, 0xdd, 0xdd,
+    0xdd, 0x11, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x88, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x55, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xcc, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x11, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x44, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x99, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xcc, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x11, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x11, 0xee, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xdd, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xcc, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x11, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xcc, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x22, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xcc, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x11, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x88, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x66, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xcc, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x11, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x44, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xaa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xcc, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x11, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x11, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x11,
+    0x66, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x11,
+    0x66, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x11,
+    0x66, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x11,
+    0x66, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x11,
+    0x11, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x66, 0x44, 0x44, 0x44, 0x44, 0x44, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x11, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x11, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x11, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x11, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x11, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x11, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x11, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 
     /* U+0035 "5" */
-    0x0, 0x0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x4,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf9, 0x0, 0x0, 0x0, 0x6f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0x7, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0,
-    0x9f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x90, 0x0, 0x0, 0xa, 0xff, 0xff,
-    0xf5, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x42,
-    0x0, 0x0, 0x0, 0xcf, 0xff, 0xff, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xd, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
-    0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xb0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xfa, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xf7, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdc,
-    0x96, 0x10, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb4,
-    0x0, 0x0, 0x0, 0x0, 0x9f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x10, 0x0,
-    0x0, 0xb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0x10, 0x0, 0x0, 0xcf,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xfc, 0x0, 0x0, 0x4, 0x44, 0x44, 0x44,
-    0x44, 0x56, 0x7a, 0xdf, 0xff, 0xff, 0xff, 0xf6,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3c, 0xff, 0xff, 0xff, 0xe0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xb,
-    0xff, 0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff, 0xff,
-    0xf6, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xdf, 0xff, 0xff, 0x80, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xc, 0xff, 0xff, 0xf8, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf, 0xff,
-    0xff, 0x70, 0x0, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf4, 0x0,
-    0x6f, 0xd4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1d, 0xff, 0xff, 0xff, 0x10, 0xe, 0xff, 0xfc,
-    0x61, 0x0, 0x0, 0x0, 0x0, 0x5e, 0xff, 0xff,
-    0xff, 0xa0, 0x7, 0xff, 0xff, 0xff, 0xfd, 0xa8,
-    0x77, 0x8a, 0xef, 0xff, 0xff, 0xff, 0xf2, 0x1,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf7, 0x0, 0x1b, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xf9, 0x0, 0x0, 0x5, 0xdf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0x0, 0x0, 0x5b, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x91, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x48, 0xbd, 0xef, 0xff, 0xec, 0x95, 0x10,
-    0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x33, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x99, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x44,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x99, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x66, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x99, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x77, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x99, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x99, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x99, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaa, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x55, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x22,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcc, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xee, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xdd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xbb, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaa,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x33, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x88, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x55,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x77, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x66, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xcc,
+    0x99, 0x66, 0x11, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x88, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0x44,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x99, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xbb, 0x11, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xbb, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd,
+    0x11, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcc, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xcc, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0x55, 0x66, 0x77, 0xaa, 0xdd, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x66,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x33, 0xcc, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xee, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbb,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x33, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x66, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdd, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x88, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xcc, 0xff, 0xff, 0xff, 0xff, 0xff, 0x88,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xdd, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x77, 0x0, 0x0, 0x0, 0x77, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x33, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x44, 0x0, 0x0,
+    0x66, 0xff, 0xdd, 0x44, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x11, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x11, 0x0, 0x0, 0xee, 0xff, 0xff, 0xff, 0xcc,
+    0x66, 0x11, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x55, 0xee, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xaa, 0x0, 0x0, 0x77, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xaa, 0x88,
+    0x77, 0x77, 0x88, 0xaa, 0xee, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0x0, 0x11,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x77,
+    0x0, 0x0, 0x11, 0xbb, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x99, 0x0, 0x0, 0x0, 0x0, 0x0, 0x55,
+    0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x66, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x55, 0xbb, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x99, 0x11, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x44, 0x88, 0xbb, 0xdd, 0xee, 0xff,
+    0xff, 0xff, 0xee, 0xcc, 0x99, 0x55, 0x11, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 
     /* U+0036 "6" */
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x15, 0x9c, 0xef,
-    0xff, 0xed, 0xa7, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x3, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xd5, 0x0, 0x0, 0x0, 0x0, 0x1a, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf3,
-    0x0, 0x0, 0x0, 0x3e, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfc, 0x0, 0x0, 0x0,
-    0x4f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x40, 0x0, 0x0, 0x3f, 0xff, 0xff,
-    0xff, 0xfe, 0xa7, 0x44, 0x45, 0x7b, 0xff, 0xc0,
-    0x0, 0x0, 0xd, 0xff, 0xff, 0xff, 0xe6, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x74, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xff, 0xc1, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0xc0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xf2, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd,
-    0xff, 0xff, 0xf9, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x2, 0xff, 0xff, 0xff,
-    0x20, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x6f, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0xfa, 0x0, 0x3, 0x8b, 0xef, 0xff,
-    0xda, 0x61, 0x0, 0x0, 0x0, 0xbf, 0xff, 0xff,
-    0x80, 0x4c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf9,
-    0x10, 0x0, 0xc, 0xff, 0xff, 0xf7, 0x8f, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x50, 0x0,
-    0xdf, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0x50, 0xe, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0x30, 0xdf, 0xff, 0xff, 0xff, 0xff,
-    0xb5, 0x10, 0x0, 0x27, 0xef, 0xff, 0xff, 0xfc,
-    0xd, 0xff, 0xff, 0xff, 0xff, 0x50, 0x0, 0x0,
-    0x0, 0x1, 0xcf, 0xff, 0xff, 0xf4, 0xbf, 0xff,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x1,
-    0xef, 0xff, 0xff, 0x99, 0xff, 0xff, 0xff, 0xc0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x7, 0xff, 0xff,
-    0xfc, 0x7f, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xe3, 0xff,
-    0xff, 0xff, 0x60, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xfe, 0xe, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f, 0xff,
-    0xff, 0xd0, 0x9f, 0xff, 0xff, 0xc0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xff, 0xff, 0xfb, 0x2,
-    0xff, 0xff, 0xff, 0x50, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xef, 0xff, 0xff, 0x70, 0xa, 0xff, 0xff,
-    0xff, 0x50, 0x0, 0x0, 0x0, 0x1, 0xcf, 0xff,
-    0xff, 0xf1, 0x0, 0x1e, 0xff, 0xff, 0xff, 0xb4,
-    0x10, 0x0, 0x28, 0xff, 0xff, 0xff, 0xf8, 0x0,
-    0x0, 0x4f, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff,
-    0xff, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0, 0x5f,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfd, 0x10, 0x0, 0x0, 0x0, 0x3d, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0x10, 0x0,
-    0x0, 0x0, 0x0, 0x7, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xd5, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x48, 0xbe, 0xff, 0xfe, 0xb8, 0x30,
-    0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x11, 0x55, 0x99, 0xcc, 0xee, 0xff,
+    0xff, 0xff, 0xee, 0xdd, 0xaa, 0x77, 0x22, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x33, 0xaa, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xdd, 0x55, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x11, 0xaa, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x33,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x33, 0xee,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xcc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x44, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x44, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x33, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xee, 0xaa, 0x77, 0x44, 0x44,
+    0x44, 0x55, 0x77, 0xbb, 0xff, 0xff, 0xcc, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xdd, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xee, 0x66, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x77, 0x44, 0x0, 0x0, 0x0, 0x0, 0x0, 0x88,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcc, 0x11,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x11, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xcc, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x77, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x22, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdd,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x99, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x22, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x66, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xdd, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x99,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xaa, 0x0, 0x0,
+    0x0, 0x33, 0x88, 0xbb, 0xee, 0xff, 0xff, 0xff,
+    0xdd, 0xaa, 0x66, 0x11, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x88, 0x0, 0x44, 0xcc, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x99,
+    0x11, 0x0, 0x0, 0x0, 0x0, 0xcc, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x77, 0x88, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x55, 0x0, 0x0, 0x0,
+    0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x55, 0x0, 0x0, 0xee, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x33, 0x0, 0xdd, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xbb, 0x55, 0x11, 0x0, 0x0, 0x0, 0x22, 0x77,
+    0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcc,
+    0x0, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x55, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x11, 0xcc, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x44, 0xbb, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x66, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x11,
+    0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0x99, 0x99,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcc, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x77, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xcc, 0x77, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x77, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x33, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xee, 0x33, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x66, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee,
+    0x0, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0x77,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x33, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xdd, 0x0, 0x99, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xcc, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x77,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0x0, 0x22,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x11, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x77, 0x0, 0x0, 0xaa, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x55, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x11, 0xcc, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x11, 0x0, 0x0, 0x11, 0xee,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0x44,
+    0x11, 0x0, 0x0, 0x0, 0x22, 0x88, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x88, 0x0, 0x0,
+    0x0, 0x0, 0x44, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x55, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xdd, 0x11, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x33, 0xdd, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xbb, 0x11, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x77,
+    0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xdd, 0x55, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x44, 0x88, 0xbb, 0xee,
+    0xff, 0xff, 0xff, 0xee, 0xbb, 0x88, 0x33, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 
     /* U+0037 "7" */
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x7a, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf7, 0xaf, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x7a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xaf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0x4a, 0xff, 0xff, 0xf6, 0x44,
-    0x44, 0x44, 0x44, 0x44, 0x44, 0xdf, 0xff, 0xff,
-    0xd0, 0xaf, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2f, 0xff, 0xff, 0xf7, 0xa, 0xff,
-    0xff, 0xf2, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9,
-    0xff, 0xff, 0xff, 0x0, 0xaf, 0xff, 0xff, 0x20,
-    0x0, 0x0, 0x0, 0x0, 0x1, 0xff, 0xff, 0xff,
-    0x90, 0xa, 0xff, 0xff, 0xf2, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xf2, 0x0, 0xaf,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0xe,
-    0xff, 0xff, 0xfb, 0x0, 0x1, 0x11, 0x11, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff, 0xff,
-    0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xcf, 0xff, 0xff, 0xd0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3f,
-    0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xfe,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xff, 0x80, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x9f,
-    0xff, 0xff, 0xf1, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xf, 0xff, 0xff, 0xfa,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x7, 0xff, 0xff, 0xff, 0x30, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdf,
-    0xff, 0xff, 0xc0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xfd, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x3, 0xff,
-    0xff, 0xff, 0x70, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff, 0xf0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x1f, 0xff, 0xff, 0xf9, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8, 0xff,
-    0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xef, 0xff, 0xff, 0xb0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x6f, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xd, 0xff,
-    0xff, 0xfd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4, 0xff, 0xff, 0xff, 0x60,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0xbf, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2f, 0xff,
-    0xff, 0xf8, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x9, 0xff, 0xff, 0xff, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x1, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0,
+    0xaa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x77, 0xaa, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x77, 0xaa, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x77, 0xaa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x77, 0xaa, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x44, 0xaa,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x66, 0x44, 0x44,
+    0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44,
+    0x44, 0x44, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xdd, 0x0, 0xaa, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x22, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x22, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x77, 0x0, 0xaa, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x22, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x99,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
+    0xaa, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x11, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x99, 0x0, 0x0, 0xaa, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x22, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x77, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x22, 0x0, 0x0, 0xaa, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x22, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xee,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0x0, 0x0,
+    0x0, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x55, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x44, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xcc, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xdd, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x33, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x66, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x22, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x88, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x99, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x11, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaa,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x77, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x33, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xdd, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xcc, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x55, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xcc, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xdd, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x33, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x77, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x11, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x99, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x88, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x22, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x66, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x44, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xdd, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xdd, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x44,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x66, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xbb, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xee, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x22, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x88, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x99,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x11, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x11, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xaa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 
     /* U+0038 "8" */
-    0x0, 0x0, 0x0, 0x0, 0x15, 0x9c, 0xef, 0xff,
-    0xed, 0xa6, 0x20, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x2, 0xaf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xc4, 0x0, 0x0, 0x0, 0x0, 0x0, 0x8,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfb, 0x10, 0x0, 0x0, 0x0, 0xb, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0x10, 0x0, 0x0, 0x8, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xfc, 0x0,
-    0x0, 0x2, 0xff, 0xff, 0xff, 0xfc, 0x51, 0x0,
-    0x1, 0x4a, 0xff, 0xff, 0xff, 0xf6, 0x0, 0x0,
-    0x8f, 0xff, 0xff, 0xf7, 0x0, 0x0, 0x0, 0x0,
-    0x3, 0xff, 0xff, 0xff, 0xd0, 0x0, 0xc, 0xff,
-    0xff, 0xfa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6,
-    0xff, 0xff, 0xff, 0x0, 0x0, 0xdf, 0xff, 0xff,
-    0x50, 0x0, 0x0, 0x0, 0x0, 0x0, 0xf, 0xff,
-    0xff, 0xf2, 0x0, 0xd, 0xff, 0xff, 0xf4, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x11, 0x55, 0x99, 0xcc, 0xee, 0xff, 0xff, 0xff,
+    0xee, 0xdd, 0xaa, 0x66, 0x22, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x22, 0xaa, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xcc, 0x44, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x88,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xbb, 0x11, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xbb, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd,
+    0x11, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x88,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xcc, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x22, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xcc, 0x55, 0x11, 0x0, 0x0,
+    0x0, 0x11, 0x44, 0xaa, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x66, 0x0, 0x0, 0x0, 0x0,
+    0x88, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x77,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x33, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xdd, 0x0, 0x0, 0x0, 0x0, 0xcc, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xaa, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x66,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x0, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x55, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
     0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff,
-    0x20, 0x0, 0xbf, 0xff, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x3f, 0xff, 0xff, 0xf0, 0x0,
-    0x6, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0,
-    0x0, 0xc, 0xff, 0xff, 0xfb, 0x0, 0x0, 0xe,
-    0xff, 0xff, 0xfe, 0x50, 0x0, 0x0, 0x0, 0x3c,
-    0xff, 0xff, 0xff, 0x40, 0x0, 0x0, 0x4f, 0xff,
-    0xff, 0xff, 0xeb, 0x98, 0x8a, 0xef, 0xff, 0xff,
-    0xff, 0x90, 0x0, 0x0, 0x0, 0x5f, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x90,
-    0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0x70, 0x0, 0x0,
-    0x0, 0x0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0,
-    0xaf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xd1, 0x0, 0x0, 0x8f, 0xff,
-    0xff, 0xff, 0xa5, 0x10, 0x0, 0x14, 0x9f, 0xff,
-    0xff, 0xff, 0xb0, 0x0, 0x2f, 0xff, 0xff, 0xfe,
-    0x30, 0x0, 0x0, 0x0, 0x0, 0x1c, 0xff, 0xff,
-    0xff, 0x60, 0x9, 0xff, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0xd, 0xff, 0xff, 0xfd,
-    0x0, 0xdf, 0xff, 0xff, 0x90, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x4f, 0xff, 0xff, 0xf2, 0xf,
-    0xff, 0xff, 0xf4, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xff, 0xff, 0xff, 0x41, 0xff, 0xff,
-    0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0xe, 0xff, 0xff, 0xf5, 0xf, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff,
-    0xff, 0xff, 0x50, 0xef, 0xff, 0xff, 0x90, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x4f, 0xff, 0xff,
-    0xf3, 0xa, 0xff, 0xff, 0xff, 0x20, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xc, 0xff, 0xff, 0xff, 0x0,
-    0x5f, 0xff, 0xff, 0xfe, 0x30, 0x0, 0x0, 0x0,
-    0x0, 0x1b, 0xff, 0xff, 0xff, 0x90, 0x0, 0xcf,
-    0xff, 0xff, 0xff, 0xa4, 0x10, 0x0, 0x3, 0x8f,
-    0xff, 0xff, 0xff, 0xf1, 0x0, 0x2, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xf6, 0x0, 0x0, 0x3, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7,
-    0x0, 0x0, 0x0, 0x2, 0xcf, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5c, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xfd, 0x70, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x2, 0x6a, 0xce, 0xff, 0xfe, 0xda,
-    0x73, 0x0, 0x0, 0x0, 0x0,
+    0xff, 0xff, 0xff, 0x22, 0x0, 0x0, 0x0, 0xdd,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x44, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x22, 0x0, 0x0, 0x0, 0xbb, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x77, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x33, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0, 0x0,
+    0x0, 0x66, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x22, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xcc, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xbb, 0x0, 0x0, 0x0, 0x0, 0x0, 0xee,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0x55, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x33, 0xcc,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x44, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x44, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xee, 0xbb, 0x99, 0x88,
+    0x88, 0xaa, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x99, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x55, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x99, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x44, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x77, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x77, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xaa, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0xaa, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0x11,
+    0x0, 0x0, 0x0, 0x0, 0x88, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xaa, 0x55, 0x11, 0x0,
+    0x0, 0x0, 0x11, 0x44, 0x99, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xbb, 0x0, 0x0, 0x0,
+    0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee,
+    0x33, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x11, 0xcc, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x66, 0x0, 0x0, 0x99, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x22, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd,
+    0x0, 0x0, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x99, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x44, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0x0, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x44, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x44, 0x11, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x33, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55,
+    0x0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x44,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x55, 0x0, 0xee, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x99, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x44, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x33, 0x0, 0xaa, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x22, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcc,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
+    0x55, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee,
+    0x33, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x11, 0xbb, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x99, 0x0, 0x0, 0x0, 0xcc, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaa, 0x44,
+    0x11, 0x0, 0x0, 0x0, 0x0, 0x33, 0x88, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x11,
+    0x0, 0x0, 0x0, 0x22, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x66, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x33, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x77,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x22,
+    0xcc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xee, 0x44, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x55, 0xcc,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0x77, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x22, 0x66, 0xaa,
+    0xcc, 0xee, 0xff, 0xff, 0xff, 0xee, 0xdd, 0xaa,
+    0x77, 0x33, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0,
 
     /* U+0039 "9" */
-    0x0, 0x0, 0x0, 0x2, 0x7b, 0xef, 0xff, 0xec,
-    0x84, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xaf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xe4, 0x0, 0x0,
-    0x0, 0x1, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0xcf,
-    0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff,
-    0xff, 0xf5, 0x0, 0x0, 0x7f, 0xff, 0xff, 0xff,
-    0x83, 0x0, 0x0, 0x4a, 0xff, 0xff, 0xff, 0xf2,
-    0x0, 0xf, 0xff, 0xff, 0xfd, 0x20, 0x0, 0x0,
-    0x0, 0x3, 0xef, 0xff, 0xff, 0xb0, 0x6, 0xff,
-    0xff, 0xff, 0x10, 0x0, 0x0, 0x0, 0x0, 0x3,
-    0xff, 0xff, 0xff, 0x40, 0xaf, 0xff, 0xff, 0x80,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xa, 0xff, 0xff,
-    0xfb, 0xc, 0xff, 0xff, 0xf4, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x5f, 0xff, 0xff, 0xf1, 0xdf,
-    0xff, 0xff, 0x30, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x4, 0xff, 0xff, 0xff, 0x5d, 0xff, 0xff, 0xf4,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x6f, 0xff,
-    0xff, 0xf8, 0xbf, 0xff, 0xff, 0x90, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0xb7,
-    0xff, 0xff, 0xff, 0x20, 0x0, 0x0, 0x0, 0x0,
-    0x5, 0xff, 0xff, 0xff, 0xfd, 0x2f, 0xff, 0xff,
-    0xfd, 0x20, 0x0, 0x0, 0x0, 0x5, 0xff, 0xff,
-    0xff, 0xff, 0xe0, 0xaf, 0xff, 0xff, 0xff, 0x94,
-    0x10, 0x2, 0x5c, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0x1, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xf0, 0x3, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
-    0xff, 0xff, 0xff, 0x0, 0x3, 0xdf, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xf8, 0x5f, 0xff, 0xff,
-    0xe0, 0x0, 0x0, 0x7e, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xb3, 0x6, 0xff, 0xff, 0xfd, 0x0, 0x0,
-    0x0, 0x4, 0x8b, 0xde, 0xec, 0xa7, 0x20, 0x0,
-    0x8f, 0xff, 0xff, 0xa0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0xc, 0xff, 0xff,
-    0xf7, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x1, 0xff, 0xff, 0xff, 0x40, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x7f, 0xff, 0xff, 0xe0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x1e, 0xff, 0xff,
-    0xf9, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0xb, 0xff, 0xff, 0xff, 0x20, 0x0,
-    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x1b,
-    0xff, 0xff, 0xff, 0x90, 0x0, 0x0, 0x28, 0x10,
-    0x0, 0x0, 0x0, 0x0, 0x5e, 0xff, 0xff, 0xff,
-    0xe1, 0x0, 0x0, 0xa, 0xff, 0xb8, 0x54, 0x44,
-    0x69, 0xef, 0xff, 0xff, 0xff, 0xf4, 0x0, 0x0,
-    0x2, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xf6, 0x0, 0x0, 0x0, 0xaf, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5,
-    0x0, 0x0, 0x0, 0x2f, 0xff, 0xff, 0xff, 0xff,
-    0xff, 0xff, 0xff, 0xff, 0xb2, 0x0, 0x0, 0x0,
-    0x0, 0x4c, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-    0xfb, 0x40, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2,
-    0x6a, 0xce, 0xff, 0xfe, 0xc9, 0x61, 0x0, 0x0,
-    0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x22,
+    0x77, 0xbb, 0xee, 0xff, 0xff, 0xff, 0xee, 0xcc,
+    0x88, 0x44, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x44, 0xcc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0x88, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0xaa, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xee, 0x44, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x11, 0xdd, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x66,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xcc, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x55, 0x0, 0x0, 0x0, 0x0,
+    0x77, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x88, 0x33, 0x0, 0x0, 0x0, 0x0, 0x44, 0xaa,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22,
+    0x0, 0x0, 0x0, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xdd, 0x22, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x33, 0xee, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xbb, 0x0, 0x0, 0x66, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x11, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x33,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x44, 0x0,
+    0xaa, 0xff, 0xff, 0xff, 0xff, 0xff, 0x88, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xaa, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xbb, 0x0, 0xcc, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x44, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x55, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x11, 0xdd, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x33, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x44, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x55, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xff, 0x44,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x66, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x88, 0xbb, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x99, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0xbb,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xbb, 0x77,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x22, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x55, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xdd, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xdd, 0x22, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x55, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xee, 0x0, 0xaa, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x99, 0x44,
+    0x11, 0x0, 0x0, 0x22, 0x55, 0xcc, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x0, 0x11, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x0, 0x0, 0x33, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x0, 0x0,
+    0x0, 0x33, 0xdd, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x88, 0x55, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xee, 0x0, 0x0, 0x0, 0x0, 0x0, 0x77, 0xee,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xbb, 0x33, 0x0, 0x66, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xdd, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x44, 0x88, 0xbb, 0xdd, 0xee,
+    0xee, 0xcc, 0xaa, 0x77, 0x22, 0x0, 0x0, 0x0,
+    0x88, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaa, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0xcc, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x77, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x11, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x44, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x77, 0xff, 0xff, 0xff, 0xff, 0xff, 0xee, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x11, 0xee, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0x99, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0xbb, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x22, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x11, 0xbb,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x99, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x22, 0x88, 0x11, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x55, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xee, 0x11, 0x0, 0x0, 0x0, 0x0, 0x0, 0xaa,
+    0xff, 0xff, 0xbb, 0x88, 0x55, 0x44, 0x44, 0x44,
+    0x66, 0x99, 0xee, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0x44, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x22, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x66, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0xaa, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x55,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x22, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xbb, 0x22, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x44, 0xcc, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xbb, 0x44, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x22,
+    0x66, 0xaa, 0xcc, 0xee, 0xff, 0xff, 0xff, 0xee,
+    0xcc, 0x99, 0x66, 0x11, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
 
     /* U+003A ":" */
-    0x0, 0x4c, 0xff, 0xa1, 0x0, 0x4f, 0xff, 0xff,
-    0xe1, 0xd, 0xff, 0xff, 0xff, 0x80, 0xff, 0xff,
-    0xff, 0xfc, 0xf, 0xff, 0xff, 0xff, 0xc0, 0xcf,
-    0xff, 0xff, 0xf8, 0x4, 0xff, 0xff, 0xfd, 0x10,
-    0x3, 0xcf, 0xfa, 0x10, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x44, 0xcc, 0xff, 0xff, 0xaa, 0x11,
+    0x0, 0x0, 0x44, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xee, 0x11, 0x0, 0xdd, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0x88, 0x0, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xcc, 0x0, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xcc, 0x0, 0xcc, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0x88, 0x0, 0x44,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xdd, 0x11, 0x0,
+    0x0, 0x33, 0xcc, 0xff, 0xff, 0xaa, 0x11, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
     0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
-    0x0, 0x0, 0x4c, 0xff, 0xa1, 0x0, 0x4f, 0xff,
-    0xff, 0xe1, 0xd, 0xff, 0xff, 0xff, 0x80, 0xff,
-    0xff, 0xff, 0xfc, 0xf, 0xff, 0xff, 0xff, 0xc0,
-    0xcf, 0xff, 0xff, 0xf8, 0x4, 0xff, 0xff, 0xfd,
-    0x10, 0x3, 0xcf, 0xfa, 0x10
+    0x0, 0x0, 0x0, 0x0, 0x44, 0xcc, 0xff, 0xff,
+    0xaa, 0x11, 0x0, 0x0, 0x44, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xee, 0x11, 0x0, 0xdd, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x88, 0x0, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xcc, 0x0, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xcc, 0x0,
+    0xcc, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x88,
+    0x0, 0x44, 0xff, 0xff, 0xff, 0xff, 0xff, 0xdd,
+    0x11, 0x0, 0x0, 0x33, 0xcc, 0xff, 0xff, 0xaa,
+    0x11, 0x0
 };
 
 
@@ -632,16 +1209,16 @@ static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {
 static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {
     {.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0} /* id = 0 reserved */,
     {.bitmap_index = 0, .adv_w = 517, .box_w = 29, .box_h = 34, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 493, .adv_w = 293, .box_w = 14, .box_h = 34, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 731, .adv_w = 447, .box_w = 27, .box_h = 34, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1190, .adv_w = 447, .box_w = 26, .box_h = 34, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 1632, .adv_w = 521, .box_w = 32, .box_h = 34, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 2176, .adv_w = 449, .box_w = 27, .box_h = 34, .ofs_x = 0, .ofs_y = 0},
-    {.bitmap_index = 2635, .adv_w = 482, .box_w = 27, .box_h = 34, .ofs_x = 2, .ofs_y = 0},
-    {.bitmap_index = 3094, .adv_w = 467, .box_w = 27, .box_h = 34, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 3553, .adv_w = 501, .box_w = 29, .box_h = 34, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4046, .adv_w = 482, .box_w = 27, .box_h = 34, .ofs_x = 1, .ofs_y = 0},
-    {.bitmap_index = 4505, .adv_w = 187, .box_w = 9, .box_h = 26, .ofs_x = 1, .ofs_y = 0}
+    {.bitmap_index = 986, .adv_w = 293, .box_w = 14, .box_h = 34, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 1462, .adv_w = 447, .box_w = 27, .box_h = 34, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 2380, .adv_w = 447, .box_w = 26, .box_h = 34, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 3264, .adv_w = 521, .box_w = 32, .box_h = 34, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 4352, .adv_w = 449, .box_w = 27, .box_h = 34, .ofs_x = 0, .ofs_y = 0},
+    {.bitmap_index = 5270, .adv_w = 482, .box_w = 27, .box_h = 34, .ofs_x = 2, .ofs_y = 0},
+    {.bitmap_index = 6188, .adv_w = 467, .box_w = 27, .box_h = 34, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 7106, .adv_w = 501, .box_w = 29, .box_h = 34, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 8092, .adv_w = 482, .box_w = 27, .box_h = 34, .ofs_x = 1, .ofs_y = 0},
+    {.bitmap_index = 9010, .adv_w = 187, .box_w = 9, .box_h = 26, .ofs_x = 1, .ofs_y = 0}
 };
 
 /*---------------------
@@ -739,7 +1316,7 @@ static lv_font_fmt_txt_dsc_t font_dsc = {
     .kern_dsc = &kern_pairs,
     .kern_scale = 16,
     .cmap_num = 1,
-    .bpp = 4,
+    .bpp = 8,
     .kern_classes = 0,
     .bitmap_format = 0,
 #if LV_VERSION_CHECK(8, 0, 0)
@@ -9,7 +9,16 @@
 #include "AudioOutputI2S.h"
 #include <pcf8574.h>
 #include <plc_timer.h>
+#include <bell_scheduler.h>
+#include <boot_profile.h>
+#include <sys_stats.h>
+#include <i2c_bus.h>
+#include <bell_log.h>
+#include <power_manager.h>
+#include <settings_store.h>
+#include <schedule_io.h>
 #include <Update.h>
+#include <mbedtls/sha256.h>
 
 RTC_DS3231* rtc;
 SPIClass SDSPI;
@@ -17,28 +26,44 @@ AudioGeneratorMP3* mp3PCM;
 AudioFileSourceSD* mp3Source;
 AudioOutputI2S* i2sOut;
 pcf8574* ioExpander;
+I2cBus i2cBus; // Own Wire after setup(), RTC and expander are only accessed through it
+WallClock wallClock; // Wall time from esp_timer, resynced to the RTC by i2cBus
+BellLog bellLog; // Bell history, written to PATH_BELL_LOG by loop()
+PowerManager powerManager; // CPU clock and light sleep, driven by power_manage() on loop()
+NvsSettingsBackend nvsSettings("jambel");
+SettingsStore settings(&nvsSettings);
+int settingVolume, settingTjActiveName, settingBelManual; // Settings id of the bound variables
 
 void audioTask_cb(void* pvParameters);
+void bootTask_cb(void* pvParameters);
+void schedulerTask_cb(void* pvParameters);
+void scheduler_tick();
 bool is_filename_mp3(const char* filename);
 void checkFirmwareBinary();
-void performFirmwareUpdate(Stream& updateSource, size_t updateSize);
+void performFirmwareUpdate(File& updateSource, size_t updateSize);
+int firmwareHash_load(uint8_t* hash);
+void firmwareReadTask_cb(void* pvParameters);
 void macCheck();
-void update_onProgress_callback(size_t s, size_t s2);
 bool rmvDir(const char* path);
-TaskHandle_t audioTask;
+void ui_benchmark();
+void ui_benchmark_step(const char* name, void (*build)());
+void ui_benchmark_close();
+void console_counters();
+void console_power();
+void power_manage();
+TaskHandle_t audioTask, schedulerTask;
 DateTime now;
 
 bool rtcBeginFailFlag, rtcPowerLostFlag, sdNotDetectedFlag;
 bool sdBeginFlag;
 
-bool bellPlayedFlag = false; // Flag used so JadwalBel audio is only played once, not repeated
-int bellPlayedIndex = 0;
 bool isAudioPlaying = false, // Signal from core 0, is audio playing?
-preAudioPlay = false, // Used for giving 2000ms delay after turning on relay and before playing audio file
 audioPlayFlag = false, // Signal from core 1 to core 0 to play the audiofile on path audioPath[256], cleared by core 0
 stopAudio = false; // Signal from core 0 to core 1 to turn off relay, cleared by core 1
 char audioPath[256] = { 0 };
 SemaphoreHandle_t audioMutex;
+uint32_t audioPlayCount, audioFailCount, audioStopCount, audioPreemptCount; // Written by audioTask only, for "cnt"
+SemaphoreHandle_t bootDone; // Given by bootTask once storage, RTC and config are ready
 
 bool wifiConnected;
 
@@ -52,7 +77,6 @@ void setup(void) {
   btStop();
   jw_used = new JadwalHari();
   jw_temp = new JadwalHari();
-  tj_lists = (TemplateJadwal*)malloc(sizeof(TemplateJadwal) * TJ_MAX_LEN);
   rtc = new RTC_DS3231();
   mp3PCM = new AudioGeneratorMP3();
   mp3Source = new AudioFileSourceSD();
@@ -60,6 +84,7 @@ void setup(void) {
   ioExpander = new pcf8574();
 
   Serial.begin(115200);
+  Blog::begin(1); // log_i/log_d are buffered from here and printed by logTask
   log_i("SDK %s", ESP.getSdkVersion());
   log_i("Release v%s", RELEASE_VER);
   log_i("CPU Freq : %luMHz", ESP.getCpuFreqMHz());
@@ -67,11 +92,59 @@ void setup(void) {
   // log_i("Flash Size : %luKB Flash Speed : %lu Flash Mode : %s", ESP.getFlashChipSize() / 1024, ESP.getFlashChipSpeed(), VERBOSE_FLASH_MODE(ESP.getFlashChipMode()));
   // log_i("Sketch MD5: %s Sketch Size : %luKB Free Sketch Space : %luKB Heap Size : %luKB Free Heap : %luKB", ESP.getSketchMD5().c_str(), ESP.getSketchSize() / 1024, ESP.getFreeSketchSpace() / 1024, ESP.getHeapSize() / 1024, ESP.getFreeHeap() / 1024);
 
+  boot_mark("setup");
+
+  // SD, RTC, IO expander and config are brought up on core 0 while the display is initialized here,
+  // the display and SD are on separate SPI buses and nothing else use I2C yet
+  bootDone = xSemaphoreCreateBinary();
+  xTaskCreatePinnedToCore(bootTask_cb, "bootTask", 4096, NULL, 1, NULL, 0);
+
   lv_init();
   lgfx_init();
   lvgl_esp32_init();
+  boot_mark("display");
   initStyles();
+  modalPool_init();
+  boot_mark("styles and modal pool");
+
+  xSemaphoreTake(bootDone, portMAX_DELAY);
+  vSemaphoreDelete(bootDone);
+  boot_mark("wait bootTask");
+  if (!i2cBus.begin(rtc, I2C_FREQ_RTC, ioExpander, I2C_FREQ_EXPANDER, &wallClock, 0))
+    log_e("I2C bus task can't start!");
+
+  i2sOut->SetPinout(I2S_BCK, I2S_WS, I2S_DO);
+  i2sOut->SetGain(volumeToGain(audioVolume));
+  i2sOut->begin();
+  boot_mark("I2S");
+
+  audioMutex = xSemaphoreCreateMutex();
+  xTaskCreatePinnedToCore(
+    audioTask_cb,   /* Task function. */
+    "audioTask",     /* name of task. */
+    10000,       /* Stack size of task */
+    NULL,        /* parameter of the task */
+    1,           /* priority of the task */
+    &audioTask,      /* Task handle to keep track of created task */
+    0);          /* pin task to core 0 */
+  log_i("Heap Size : %luKB\nFree Heap : %luKB", ESP.getHeapSize() / 1024, ESP.getFreeHeap() / 1024);
+
+  loadMainScreen();
+  boot_mark("main screen built");
 
+  checkFirmwareBinary(); // Draw on the display directly, must be done before LVGL task start
+
+  i2cBus.expanderWrite(Expander::I2S_EN, HIGH);
+
+  lvgl_task_start();
+  xTaskCreatePinnedToCore(schedulerTask_cb, "schedulerTask", 4096, NULL, 3, &schedulerTask, 1);
+  powerManager.begin(touchPenIrqPin);
+  boot_mark("tasks started");
+}
+
+// Boot phases that don't touch the display, run on core 0 alongside the display init of setup()
+void bootTask_cb(void* pvParameters) {
+  boot_mark("bootTask");
   SDSPI.begin(SD_CLK, SD_DO, SD_DI, SD_CS);
   SDSPI.setFrequency(SDSPI_FREQUENCY);
   sdBeginFlag = SD.begin(SD_CS, SDSPI, SDSPI_FREQUENCY);
@@ -81,6 +154,7 @@ void setup(void) {
     log_d("SD.begin() failed");
     sdNotDetectedFlag = true;
   }
+  boot_mark("SD");
 
   // Uncomment following line if ESPSYS_FS is not SD
   // log_d("Inizializing FS...\n");
@@ -94,48 +168,61 @@ void setup(void) {
   if (rtcBeginFailFlag)
     log_e("RTC not found!");
   rtcPowerLostFlag = rtc->lostPower();
-
   now = rtc->now();
+  ioExpander->init(IOEXPAND_I2C_ADDRESS);
+  ioExpander->writeByte(0x00);
+  boot_mark("RTC and IO expander");
+
+  if (!settings.begin())
+    log_e("NVS settings not available!");
+  settingVolume = settings.bind("volume", audioVolume);
+  settingTjActiveName = settings.bind("tj_active", tj_active_name);
+  settingBelManual = settings.bind("bel_manual", belManual);
+  settings.loadAll(); // The *_load() below are served from cache, SD is only read to migrate old files
   volume_load();
   belManual_load(belManual, belManual_len);
   templateJadwal_activeName_load();
+  boot_mark("settings");
   templateJadwal_list_load();
   jadwalHari_load(&tj_used, jw_used, tj_used.tipeJadwal == TJ_MINGGUAN ? now.dayOfTheWeek() : 0);
-
-  i2sOut->SetPinout(I2S_BCK, I2S_WS, I2S_DO);
-  i2sOut->SetGain(volumeToGain(audioVolume));
-  i2sOut->begin();
-
-  ioExpander->init(IOEXPAND_I2C_ADDRESS);
-  ioExpander->writeByte(0x00);
-
-  audioMutex = xSemaphoreCreateMutex();
-  xTaskCreatePinnedToCore(
-    audioTask_cb,   /* Task function. */
-    "audioTask",     /* name of task. */
-    10000,       /* Stack size of task */
-    NULL,        /* parameter of the task */
-    1,           /* priority of the task */
-    &audioTask,      /* Task handle to keep track of created task */
-    0);          /* pin task to core 0 */
-  log_i("Heap Size : %luKB\nFree Heap : %luKB", ESP.getHeapSize() / 1024, ESP.getFreeHeap() / 1024);
-
-  loadMainScreen();
-
   macCheck();
-  checkFirmwareBinary();
+  boot_mark("templates and jadwal");
 
-  ioExpander->write(Expander::I2S_EN, HIGH);
+  xSemaphoreGive(bootDone);
+  vTaskDelete(NULL);
 }
 
 unsigned long lastRTCMillis;
 uint8_t lastSecond, lastDay;
 bool stled_status = false;
-TON timerDelayStart(2000);
-TON timerDelayStop(2000);
+
+// Bell output of the device, relay on the IO expander and audio through the audioTask flags
+class DeviceBellOutput : public BellOutput
+{
+public:
+  void lock() { xSemaphoreTake(audioMutex, portMAX_DELAY); }
+  void unlock() { xSemaphoreGive(audioMutex); }
+  void relay(bool on) { i2cBus.expanderWrite(Expander::AUDIO_RELAY, on); }
+  void playAudio(const char* file) {
+    strcpy(audioPath, file);
+    audioPlayFlag = true; // Signal to core 0 to play the bell
+    log_d("Bell rang! file : %s", audioPath);
+  }
+  bool audioPlaying() { return isAudioPlaying; }
+  bool audioStopped() { return stopAudio; }
+  void clearAudioStopped() { stopAudio = false; }
+} deviceBellOutput;
+BellScheduler bellScheduler(deviceBellOutput);
 
 void loop() {
+  static bool bootProfilePrinted = false;
+  if (!bootProfilePrinted && renderFrameCount) {
+    bootProfilePrinted = true;
+    boot_profile_dump();
+  }
   //Check to see if anything is available in the serial receive buffer
+  if (Serial.available() > 0)
+    powerManager.uartActivity(); // Stay awake for the rest of the command, see the wake preamble on power_manager.h
   while (Serial.available() > 0)
   {
     static constexpr int maxMessageLength = 10;
@@ -161,15 +248,162 @@ void loop() {
       // Sending "gmac" to ESP32 will print eFuse MAC to serial
       if (strcmp(message, "gmac\r") == 0)
         Serial.printf("eFuse MAC : %llX\n", ESP.getEfuseMac());
+      // Sending "redraw" will print full screen redraw time
+      else if (strcmp(message, "redraw\r") == 0)
+      {
+        lvgl_lock();
+        Serial.printf("Full screen redraw : %lu us\n", lvgl_measure_redraw());
+        lvgl_unlock();
+      }
+      // Sending "fbench" will print glyph lookup and render time of the custom fonts
+      else if (strcmp(message, "fbench\r") == 0)
+      {
+        lvgl_lock();
+        lvgl_font_benchmark("Montserrat_SemiBold91", &Montserrat_SemiBold91);
+        lvgl_font_benchmark("Montserrat_SemiBold48", &Montserrat_SemiBold48);
+        lvgl_unlock();
+      }
+      // Sending "lvmem" will print LVGL heap usage of each screen and modal
+      else if (strcmp(message, "lvmem\r") == 0)
+      {
+        lvgl_lock();
+        lvgl_mem_dump();
+        lvgl_unlock();
+      }
+      // Sending "rstat" will print timing of the last rendered frames
+      else if (strcmp(message, "rstat\r") == 0)
+      {
+        lvgl_lock();
+        lvgl_render_stats_dump();
+        lvgl_unlock();
+      }
+      // Sending "uibench" will open every screen and dialog and print their build and redraw cost
+      else if (strcmp(message, "uibench\r") == 0)
+        ui_benchmark();
+      // Sending "boot" will print the boot phase timestamps
+      else if (strcmp(message, "boot\r") == 0)
+        boot_profile_dump();
+      // Sending "tasks", "heap", "cnt" or "stat" (all of them) will print telemetry records, see sys_stats.h.
+      // Nothing is allocated and lvglMutex isn't taken, so the UI keeps running
+      else if (strcmp(message, "tasks\r") == 0 || strcmp(message, "heap\r") == 0 || strcmp(message, "cnt\r") == 0 || strcmp(message, "stat\r") == 0)
+      {
+        bool all = message[0] == 's';
+        if (all || message[0] == 't')
+          sys_stats_tasks();
+        if (all || message[0] == 'h')
+          sys_stats_heap();
+        if (all || message[0] == 'c')
+          console_counters();
+        Serial.write("end\n");
+      }
+      // Sending "clock" will resync the wall clock on the next RTC second and print how far it was from the RTC
+      else if (strcmp(message, "clock\r") == 0)
+      {
+        uint32_t syncs = wallClock.syncs, start = millis();
+        if (i2cBus.clockResync())
+          while (wallClock.syncs == syncs && millis() - start < 1500)
+            delay(10);
+        sys_stats_printf("clock synced=%d offset_ms=%ld drift_ppb=%ld syncs=%lu since_sync_ms=%lu resync_period_ms=%lu rtc_reads=%lu\n",
+          wallClock.syncs != syncs, wallClock.lastOffsetMs, wallClock.drift(), wallClock.syncs, millis() - wallClock.lastSyncMillis,
+          i2cBus.resyncPeriod, i2cBus.rtcReads);
+      }
+      // Sending "pm" will print the time spent in each power state and the light sleep wake ups
+      else if (strcmp(message, "pm\r") == 0)
+      {
+        console_power();
+        Serial.write("end\n");
+      }
+      // Sending "fbps" will print display flush bytes per second since the last "fbps"
+      else if (strcmp(message, "fbps\r") == 0)
+      {
+        static uint32_t lastFlushBytes, lastFlushMillis;
+        uint32_t elapsed = millis() - lastFlushMillis;
+        Serial.printf("Flush : %lu B/s, clock cells : %lu px\n", (uint32_t)((uint64_t)(lvglFlushBytes - lastFlushBytes) * 1000 / (elapsed ? elapsed : 1)), mainScreen_clock.invalidatedArea);
+        lastFlushBytes = lvglFlushBytes;
+        lastFlushMillis = millis();
+        mainScreen_clock.invalidatedArea = 0;
+      }
 
       //Reset for the next message
       message_pos = 0;
     }
   }
+  // Bell history to SD here, away from the scheduler and its lvglMutex. Only trigger() and audioStart/End()
+  // run on the bell path and they never wait for SD (FATFS serialize the access with the other tasks)
+  if (sdBeginFlag)
+    bellLog.loop(ESPSYS_FS, PATH_BELL_LOG);
+  power_manage();
+  delay(10); // Only serial and the bell log are handled here, LVGL and the scheduler run on their own task
+}
+
+// Full clock while the UI is used or a bell is running or near, PM_FREQ_IDLE otherwise. Idle on mainScreen, sleep
+// until the next second so the clock still tick, or until the pre-roll of the next bell
+void power_manage() {
+  lvgl_lock();
+  uint32_t inactive = lv_disp_get_inactive_time(NULL);
+  bool onMainScreen = lv_scr_act() == mainScreen;
+  int64_t nowMs = wallClock.nowMs();
+  int64_t toBell = INT32_MAX; // ms until the next bell of today
+  if (bellScheduler.nextIndex != BELL_NONE) {
+    uint32_t tbel = jw_used->jadwalBel[bellScheduler.nextIndex];
+    toBell = (int64_t)(tbel / 100 * 3600 + tbel % 100 * 60) * 1000 - nowMs % 86400000;
+  }
+  lvgl_unlock();
+
+  bool bellBusy = isAudioPlaying || audioPlayFlag || stopAudio || bellScheduler.pending();
+  if (bellBusy || inactive < PM_IDLE_TIMEOUT || toBell < PM_BELL_PREROLL) {
+    powerManager.enter(PM_ACTIVE);
+    i2cBus.resyncPeriod = WALLCLOCK_RESYNC_PERIOD;
+    return;
+  }
+  powerManager.enter(PM_IDLE);
+#if PM_LIGHT_SLEEP
+  // esp_timer is less accurate in light sleep, and the bus task timeout only count awake ticks
+  i2cBus.resyncPeriod = PM_SLEEP_RESYNC_PERIOD;
+  if (millis() - wallClock.lastSyncMillis >= PM_SLEEP_RESYNC_PERIOD && !i2cBus.resyncing())
+    i2cBus.clockResync();
+  if (!onMainScreen || i2cBus.resyncing() || millis() - powerManager.awakeMillis < PM_MIN_AWAKE || Serial.available()
+    || powerManager.uartAwake())
+    return;
+  int64_t sleepMs = 1000 - nowMs % 1000;
+  if (toBell - PM_BELL_PREROLL < sleepMs)
+    sleepMs = toBell - PM_BELL_PREROLL;
+
+  lvgl_lock();
+  lvgl_flush_complete(); // Display DMA and touch share the SPI bus
+  xSemaphoreTake(audioMutex, portMAX_DELAY);
+  i2cBus.lock();
+  if (!audioPlayFlag && !isAudioPlaying && !i2cBus.resyncing() && sleepMs > 0) {
+    Blog::flush();
+    Serial.flush();
+    if (powerManager.sleep(sleepMs * 1000) == ESP_SLEEP_WAKEUP_GPIO)
+      lvgl_touch_wakeup();
+    wallClock.sleepHappened();
+  }
+  i2cBus.unlock();
+  xSemaphoreGive(audioMutex);
+  lvgl_unlock();
+#endif
+}
+
+// Clock, bell check and relay timers, run every SCHEDULER_PERIOD with lvglMutex held because it
+// update the UI and share jw_used with UI callbacks, RTC and IO expander go through i2cBus
+void schedulerTask_cb(void* pvParameters) {
+  log_i("schedulerTask running on core %d", xPortGetCoreID());
+  TickType_t lastWakeTime = xTaskGetTickCount();
+  for (;;) {
+    lvgl_lock();
+    scheduler_tick();
+    lvgl_unlock();
+    vTaskDelayUntil(&lastWakeTime, pdMS_TO_TICKS(SCHEDULER_PERIOD));
+  }
+}
+
+void scheduler_tick() {
+  now = wallClock.now(); // Kept from esp_timer, the RTC is only read by the I2C bus task to resync
   if (millis() - lastRTCMillis >= 1000) {
     lastRTCMillis = millis();
-    now = rtc->now();
-    ioExpander->write(Expander::ST_LED, stled_status);
+    i2cBus.expanderWrite(Expander::ST_LED, stled_status);
     stled_status = !stled_status;
   }
 
@@ -177,52 +411,20 @@ void loop() {
     if (lastDay != now.day()) {
       jadwalHari_load(&tj_used, jw_used, tj_used.tipeJadwal == TJ_MINGGUAN ? now.dayOfTheWeek() : 0);
       lastDay = now.day();
+      if (lv_scr_act() == mainMenu) // Only the rows that differ from yesterday are updated
+        tabelJadwalHariIni();
+      else if (lv_scr_act() == mainScreen) // Otherwise set by loadMainScreen()
+        lv_label_set_text_fmt(mainScreen_date, "%s, %d %s %d", dowToStr(now.dayOfTheWeek()), now.day(), monthToStr(now.month()), now.year());
     }
-    if (lv_scr_act() == mainScreen) { // Update mainScreen clock and date every second
-      lv_label_set_text_fmt(mainScreen_clock, "%02d:%02d:%02d", now.hour(), now.minute(), now.second());
-      lv_label_set_text_fmt(mainScreen_date, "%s, %d %s %d", dowToStr(now.dayOfTheWeek()), now.day(), monthToStr(now.month()), now.year());
-    }
-    uint16_t tbel = (now.hour() * 100) + now.minute();
-    for (int i = 0; i < jw_used->jumlahBel;i++) { // Check bel index every second
-      if (tbel == jw_used->jadwalBel[i] && !bellPlayedFlag) { // Ring the audio bell once!
-
-        // Set flag to true to avoid playing audio file more than once
-        bellPlayedFlag = true;
-        bellPlayedIndex = i;
-
-        ioExpander->write(Expander::AUDIO_RELAY, HIGH);
-        xSemaphoreTake(audioMutex, portMAX_DELAY);
-        // If the audio already playing,
-        // Or if the audio is stopped from playing but relay is still on then signal core 0 to play specified audio immediately
-        if (isAudioPlaying || stopAudio) {
-          if (stopAudio) // Clear stopAudio flag because we play another audio
-            stopAudio = false;
-          // Signal to core 0 to play the bell immediately
-          audioPlayFlag = true;
-          log_d("Bell rang! file : %s", audioPath);
-        } // If audio is not playing, wait for 2 seconds then play the audio
-        else
-          preAudioPlay = true;
-        strcpy(audioPath, jw_used->belAudioFile[i]);
-        xSemaphoreGive(audioMutex);
-      }
-      if (tbel < jw_used->jadwalBel[i]) {
-        nextBelIndex = i;
-        break;
-      }
-      if (i == jw_used->jumlahBel - 1 && tbel >= jw_used->jadwalBel[i]) {
-        nextBelIndex = 255;
-        break;
-      }
-    }
-    if (bellPlayedFlag) { // Reset the flag if time already past the played jadwalBel
-      if (tbel > jw_used->jadwalBel[bellPlayedIndex]) {
-        bellPlayedFlag = false;
-        log_d("Bell reset!");
-      }
+    if (lv_scr_act() == mainScreen) { // Update mainScreen clock every second
+      char clockText[9];
+      snprintf(clockText, sizeof(clockText), "%02d:%02d:%02d", now.hour(), now.minute(), now.second());
+      mainScreen_clock.set(clockText); // Only the changed digits are redrawn
     }
-    if (jw_used->jumlahBel == 0)
-      nextBelIndex = 255;
+    int rang = bellScheduler.check(*jw_used, (now.hour() * 100) + now.minute());
+    if (rang >= 0)
+      bellLog.trigger(wallClock.nowMs(), jw_used->jadwalBel[rang], rang, jw_used->belAudioFile[rang]);
+    nextBelIndex = bellScheduler.nextIndex;
     if (nextBelIndex != lastNextBelIndex) { // Update next bel
       if (lv_scr_act() == mainScreen) {
         if (nextBelIndex == 255) { // No more bell for today
@@ -238,29 +440,13 @@ void loop() {
       }
       lastNextBelIndex = nextBelIndex;
     }
+    lvgl_wake();
   }
 
-  lv_task_handler();
   lastSecond = now.second();
 
-  timerDelayStart.IN(preAudioPlay);
-  xSemaphoreTake(audioMutex, portMAX_DELAY);
-  timerDelayStop.IN(stopAudio);
-  xSemaphoreGive(audioMutex);
-  if (timerDelayStart.Q()) {
-    preAudioPlay = false;
-    // Signal to core 0 to play the bell
-    xSemaphoreTake(audioMutex, portMAX_DELAY);
-    audioPlayFlag = true;
-    log_d("Bell rang! file : %s", audioPath);
-    xSemaphoreGive(audioMutex);
-  }
-  if (timerDelayStop.Q()) { // Turn off relay after 2 seconds of signal from core 0 to stop
-    stopAudio = false;
-    ioExpander->write(Expander::AUDIO_RELAY, LOW);
-  }
-  lv_timer_handler(); /* let the GUI do its work */
-  delay(1);
+  bellScheduler.update();
+  settings.loop(); // Write back changed settings once they settle
 }
 
 void audioTask_cb(void* pvParameters) {
@@ -275,21 +461,34 @@ void audioTask_cb(void* pvParameters) {
       isAudioPlaying = mp3PCM->isRunning();
       if (lastIsAudioPlaying == true && isAudioPlaying == false && audioPlayFlag == false) { // Falling edge detection of isAudioPlaying, and no audioPlay command for core 0
         stopAudio = true;
+        audioStopCount++;
+        bellLog.audioEnd();
         log_d("Audio stopped!");
       }
       if (audioPlayFlag) {
         audioPlayFlag = false;
         log_d("Received flag, check %s!", audioPath);
         if (is_filename_mp3(audioPath)) { // Only open the file if it's mp3
-          if (mp3PCM->isRunning()) {
+          bool preempts = mp3PCM->isRunning();
+          if (preempts) {
             mp3PCM->stop();
             mp3Source->close();
+            audioPreemptCount++;
           }
           log_d("Playing %s!", audioPath);
           mp3Source->open(audioPath);
-          mp3PCM->begin(mp3Source, i2sOut);
+          if (mp3PCM->begin(mp3Source, i2sOut)) {
+            audioPlayCount++;
+            bellLog.audioStart(0, preempts);
+          }
+          else {
+            audioFailCount++;
+            bellLog.audioStart(BELLOG_ERR_BEGIN, preempts);
+          }
         }
         else {
+          audioFailCount++;
+          bellLog.audioStart(BELLOG_ERR_NOT_MP3, false);
           log_e("File is not mp3!");
           stopAudio = true;
           log_d("Audio stopped!");
@@ -320,8 +519,9 @@ bool is_filename_mp3(const char* filename) {
 }
 
 void loadMainScreen() {
-  now = rtc->now();
+  now = wallClock.now();
   lv_obj_t* label;
+  lvgl_mem_scope_begin(lvMemScopes[LVMEM_MAIN_SCREEN]);
   mainScreen = lv_obj_create(NULL);
   lv_obj_add_style(mainScreen, &scr1Bg, 0);
   lv_obj_set_scrollbar_mode(mainScreen, LV_SCROLLBAR_MODE_OFF);
@@ -351,9 +551,9 @@ void loadMainScreen() {
     }, LV_EVENT_SCREEN_LOADED, NULL);
 
   // Jam Utama
-  mainScreen_clock = lv_label_create(mainScreen);
-  lvc_label_init(mainScreen_clock, &Montserrat_SemiBold91, LV_ALIGN_CENTER, 0, -80, bs_white);
-  lv_label_set_text_fmt(mainScreen_clock, "%02d:%02d:%02d", now.hour(), now.minute(), now.second());
+  char clockText[9];
+  snprintf(clockText, sizeof(clockText), "%02d:%02d:%02d", now.hour(), now.minute(), now.second());
+  lv_obj_align(mainScreen_clock.create(mainScreen, &Montserrat_SemiBold91, bs_white, clockText), LV_ALIGN_CENTER, 0, -80);
 
   // Tanggal hari ini
   mainScreen_date = lv_label_create(mainScreen);
@@ -420,7 +620,11 @@ void loadMainScreen() {
   label = lv_label_create(mainScreen);
   lvc_label_init(label, &lv_font_montserrat_12, LV_ALIGN_CENTER, 0, 140, bs_white);
   lv_label_set_text_fmt(label, LV_SYMBOL_UP"\nSwipe ke atas");
-  lv_scr_load_anim(mainScreen, LV_SCR_LOAD_ANIM_MOVE_BOTTOM, 500, 0, true);
+  lvgl_mem_scope_end(lvMemScopes[LVMEM_MAIN_SCREEN], mainScreen);
+  modalPool_closeAll(); // Old screen is deleted after the animation
+  static bool firstLoad = true; // Nothing to slide from at boot, show the screen on the first frame
+  lv_scr_load_anim(mainScreen, LV_SCR_LOAD_ANIM_MOVE_BOTTOM, firstLoad ? 0 : 500, 0, true);
+  firstLoad = false;
 }
 
 void loadMainMenu() {
@@ -453,10 +657,17 @@ void loadMainMenu() {
     loadMainScreen();
     }, LV_EVENT_CLICKED, NULL);
 
+  lvgl_mem_scope_begin(lvMemScopes[LVMEM_MENU_TAB1]);
   tabOne();
+  lvgl_mem_scope_end(lvMemScopes[LVMEM_MENU_TAB1], mainMenu);
+  lvgl_mem_scope_begin(lvMemScopes[LVMEM_MENU_TAB2]);
   tabTwo();
+  lvgl_mem_scope_end(lvMemScopes[LVMEM_MENU_TAB2], mainMenu);
+  lvgl_mem_scope_begin(lvMemScopes[LVMEM_MENU_TAB3]);
   tabThree();
+  lvgl_mem_scope_end(lvMemScopes[LVMEM_MENU_TAB3], mainMenu);
 
+  modalPool_closeAll(); // Old screen is deleted after the animation
   lv_scr_load_anim(mainMenu, LV_SCR_LOAD_ANIM_MOVE_TOP, 500, 0, true);
   lv_obj_add_event_cb(mainMenu, [](lv_event_t* e) {
     lv_event_code_t code = lv_event_get_code(e);
@@ -518,21 +729,9 @@ void tabOne() {
       }, LV_EVENT_CLICKED, NULL);
     lv_obj_add_event_cb(button, [](lv_event_t* e) {
       WidgetParameterData* wpd = (WidgetParameterData*)lv_event_get_param(e);
-
-      ioExpander->write(Expander::AUDIO_RELAY, HIGH);
-      xSemaphoreTake(audioMutex, portMAX_DELAY);
-      // If the audio already playing,
-      // Or if the audio is stopped from playing but relay is still on then signal core 0 to play specified audio immediately
-      if (isAudioPlaying || stopAudio) {
-        if (stopAudio) // Clear stopAudio flag because we play another audio
-          stopAudio = false;// Signal to core 0 to play the bell immediately
-        audioPlayFlag = true;
-        log_d("Bell rang! file : %s", audioPath);
-      } // If audio is not playing, wait for 2 seconds then play the audio
-      else
-        preAudioPlay = true;
-      strcpy(audioPath, belManual[lv_obj_get_index(wpd->issuer) - 2].audioFile);
-      xSemaphoreGive(audioMutex);
+      uint8_t index = lv_obj_get_index(wpd->issuer) - 2;
+      bellLog.trigger(wallClock.nowMs(), BELLOG_MANUAL, index, belManual[index].audioFile);
+      bellScheduler.ring(belManual[index].audioFile);
 
       }, LV_EVENT_REFRESH, NULL);
     if (!belManual[i].enabled)
@@ -590,10 +789,6 @@ void tabTwo() {
   button = lv_btn_create(box);
   lvc_btn_init(button, "Buat Template\nJadwal Baru", LV_ALIGN_TOP_RIGHT, -13, 13);
   lv_obj_add_event_cb(button, [](lv_event_t* e) {
-    if (tj_total_active == 10) {
-      modal_create_alert("Tidak dapat menambah template jadwal lagi!", "Peringatan!", &lv_font_montserrat_20, &lv_font_montserrat_14, bs_white, bs_dark, bs_danger);
-      return;
-    }
     TemplateJadwalBuilder::create(0);
     }, LV_EVENT_CLICKED, NULL);
   tj_table_build();
@@ -683,13 +878,13 @@ void tabThree() {
       int ta1 = atoi(lv_textarea_get_text(lv_obj_get_child(modal, 1))),
         ta2 = atoi(lv_textarea_get_text(lv_obj_get_child(modal, 3))),
         ta3 = atoi(lv_textarea_get_text(lv_obj_get_child(modal, 5)));
-      now = rtc->now();
+      now = wallClock.now();
       if (issuerIdx == 0) {
-        rtc->adjust(DateTime(now.year(), now.month(), now.day(), ta1, ta2, ta3));
+        i2cBus.rtcAdjust(DateTime(now.year(), now.month(), now.day(), ta1, ta2, ta3));
         log_d("Jam %d:%d:%d", ta1, ta2, ta3);
       }
       else {
-        rtc->adjust(DateTime(ta3, ta2, ta1, now.hour(), now.minute(), now.second()));
+        i2cBus.rtcAdjust(DateTime(ta3, ta2, ta1, now.hour(), now.minute(), now.second()));
         log_d("Tanggal %d/%d/%d", ta1, ta2, ta3);
       }
       lv_obj_del(overlay);
@@ -769,6 +964,75 @@ void tabThree() {
   lv_obj_align_to(componentLabel, adjustVolumeBtn, LV_ALIGN_OUT_TOP_LEFT, 0, -5);
   lv_label_set_text_static(componentLabel, "Atur Volume");
 
+  auto importModal = [](lv_event_t* e) {
+    static char importMessage[128];
+    int imported = 0;
+    bool failed = false;
+    File root = ESPSYS_FS.open(PATH_JADWAL_IMPORT);
+    if (!sdBeginFlag || !root || !root.isDirectory()) {
+      snprintf(importMessage, sizeof(importMessage), "Folder %s tidak ditemukan", PATH_JADWAL_IMPORT);
+      failed = true;
+    }
+    else {
+      char path[TRAVERSER_MAX_TRAVERSING_LEN];
+      File file = root.openNextFile();
+      while (file && !failed) {
+        const char* ext = strrchr(file.name(), '.');
+        if (!file.isDirectory() && ext && (strcasecmp(ext, ".csv") == 0 || strcasecmp(ext, ".json") == 0)) {
+          snprintf(path, sizeof(path), PATH_JADWAL_IMPORT"%s", file.name());
+          file.close();
+          failed = !templateJadwal_import(path, importMessage, sizeof(importMessage));
+          imported += !failed;
+        }
+        file = root.openNextFile();
+      }
+      file.close();
+    }
+    root.close();
+    if (imported > 0) {
+      templateJadwal_list_load();
+      tj_table_build();
+    }
+    if (failed)
+      modal_create_alert(importMessage, "Gagal!", &lv_font_montserrat_20, &lv_font_montserrat_14, bs_white, bs_dark, bs_danger);
+    else if (imported == 0)
+      modal_create_alert("Tidak ada file .csv atau .json pada folder " PATH_JADWAL_IMPORT, "Peringatan!");
+    else {
+      if (imported > 1)
+        snprintf(importMessage, sizeof(importMessage), "%d template jadwal berhasil diimport", imported);
+      modal_create_alert(importMessage, "Sukses", &lv_font_montserrat_20, &lv_font_montserrat_14, bs_white, bs_dark, bs_success);
+    }
+  };
+  auto exportModal = [](lv_event_t* e) {
+    bool ok = sdBeginFlag;
+    if (ok && !ESPSYS_FS.exists("/jadwal"))
+      ok = ESPSYS_FS.mkdir("/jadwal");
+    if (ok && !ESPSYS_FS.exists("/jadwal/export"))
+      ok = ESPSYS_FS.mkdir("/jadwal/export");
+    char path[64];
+    for (int i = 0; ok && i < tj_total_active; i++) {
+      sprintf(path, PATH_JADWAL_EXPORT"%s.csv", tj_lists[i].name);
+      ok = templateJadwal_export(&tj_lists[i], path, false);
+    }
+    if (ok)
+      modal_create_alert("Template jadwal berhasil diexport ke folder " PATH_JADWAL_EXPORT, "Sukses", &lv_font_montserrat_20, &lv_font_montserrat_14, bs_white, bs_dark, bs_success);
+    else
+      modal_create_alert("Gagal export template jadwal!", "Gagal!", &lv_font_montserrat_20, &lv_font_montserrat_14, bs_white, bs_dark, bs_danger);
+  };
+
+  lv_obj_t* importBtn = lv_btn_create(box);
+  lvc_btn_init(importBtn, "Import Jadwal", LV_ALIGN_TOP_RIGHT, -15, 35);
+  lv_obj_add_event_cb(importBtn, importModal, LV_EVENT_CLICKED, NULL);
+
+  lv_obj_t* exportBtn = lv_btn_create(box);
+  lvc_btn_init(exportBtn, "Export Jadwal", LV_ALIGN_TOP_RIGHT, -15, 80);
+  lv_obj_add_event_cb(exportBtn, exportModal, LV_EVENT_CLICKED, NULL);
+
+  componentLabel = lv_label_create(box);
+  lvc_label_init(componentLabel);
+  lv_obj_align_to(componentLabel, importBtn, LV_ALIGN_OUT_TOP_RIGHT, 0, -5);
+  lv_label_set_text_static(componentLabel, "Import/Export Jadwal : ");
+
   lv_obj_t* releaseVer = lv_label_create(box);
   lvc_label_init(releaseVer);
   lv_obj_align_to(releaseVer, adjustVolumeBtn, LV_ALIGN_OUT_BOTTOM_LEFT, 0, 20);
@@ -780,43 +1044,48 @@ void tabThree() {
   lv_label_set_text_fmt(md5, "MD5 : %s", ESP.getSketchMD5().c_str());
 }
 
-void tabelJadwalHariIni() {
-  jadwalHari_load(&tj_used, jw_used, tj_used.tipeJadwal == TJ_MINGGUAN ? now.dayOfTheWeek() : 0);
+// Rows are only reformatted into the table when they differ from what is shown, set reload to read
+// jw_used again from SD first (template or its bel table changed)
+void tabelJadwalHariIni(bool reload) {
+  if (reload)
+    jadwalHari_load(&tj_used, jw_used, tj_used.tipeJadwal == TJ_MINGGUAN ? now.dayOfTheWeek() : 0);
 
   static const char* jw_table_header[4] = { "#","Nama","Jam\nBel","File Audio" };
   lv_coord_t col_dsc[] = { 46, 160, 76, 132, LV_GRID_TEMPLATE_LAST };
-  // Create the table for current tabel jadwal used for this day
+  // Create the table for current tabel jadwal used for this day, once per mainMenu
   lv_obj_t* secondBox = lv_obj_get_child(tab1, 1);
-  if (lv_obj_get_child(secondBox, 3) != NULL && lv_obj_get_child(secondBox, 3) == jw_lv_list_table) {
-    log_d("deleting jw_lv_list_table because it already existed");
-    lv_obj_del(jw_lv_list_table);
+  if (lv_obj_get_child(secondBox, 3) == NULL || lv_obj_get_child(secondBox, 3) != jw_lv_list_table) {
+    jw_lv_list_table = lv_table_create(secondBox);
+    lv_obj_add_style(jw_lv_list_table, &style_noBorder, 0);
+    lv_obj_set_style_text_align(jw_lv_list_table, LV_TEXT_ALIGN_CENTER, LV_PART_ITEMS | LV_STATE_DEFAULT);
+    lvc_obj_set_pad_wrapper(jw_lv_list_table, 255, 255, 2, 2, LV_PART_ITEMS);
+    lv_obj_set_style_translate_y(jw_lv_list_table, 50, 0);
+    lv_obj_set_height(jw_lv_list_table, LV_SIZE_CONTENT);
+
+    lv_table_set_col_cnt(jw_lv_list_table, 4);
+    lv_table_set_row_cnt(jw_lv_list_table, jw_used->jumlahBel ? jw_used->jumlahBel + 1 : 2);
+    for (int i = 0;i < 4;i++) {
+      lv_table_set_cell_value(jw_lv_list_table, 0, i, jw_table_header[i]);
+      lv_table_set_col_width(jw_lv_list_table, i, col_dsc[i]);
+    }
   }
-  jw_lv_list_table = lv_table_create(secondBox);
-  lv_obj_add_style(jw_lv_list_table, &style_noBorder, 0);
-  lv_obj_set_style_text_align(jw_lv_list_table, LV_TEXT_ALIGN_CENTER, LV_PART_ITEMS | LV_STATE_DEFAULT);
-  lvc_obj_set_pad_wrapper(jw_lv_list_table, 255, 255, 2, 2, LV_PART_ITEMS);
-  lv_obj_set_style_translate_y(jw_lv_list_table, 50, 0);
-  lv_obj_set_height(jw_lv_list_table, LV_SIZE_CONTENT);
-
-  lv_table_set_col_cnt(jw_lv_list_table, 4);
-  lv_table_set_row_cnt(jw_lv_list_table, jw_used->jumlahBel + 1);
+  else if (lv_table_get_row_cnt(jw_lv_list_table) != (jw_used->jumlahBel ? jw_used->jumlahBel + 1 : 2))
+    lv_table_set_row_cnt(jw_lv_list_table, jw_used->jumlahBel ? jw_used->jumlahBel + 1 : 2);
 
-  for (int i = 0;i < 4;i++) {
-    lv_table_set_cell_value(jw_lv_list_table, 0, i, jw_table_header[i]);
-    lv_table_set_col_width(jw_lv_list_table, i, col_dsc[i]);
-  }
+  lvc_table_set_empty_row(jw_lv_list_table, jw_used->jumlahBel == 0, "Tidak ada bel untuk hari ini");
+  char cell[16];
+  int changedRows = 0;
   for (int i = 0; i < jw_used->jumlahBel;i++) {
-    lv_table_set_cell_value_fmt(jw_lv_list_table, i + 1, 0, "%d", i + 1);
-    lv_table_set_cell_value_fmt(jw_lv_list_table, i + 1, 1, jw_used->namaBel[i]);
-    lv_table_set_cell_value_fmt(jw_lv_list_table, i + 1, 2, "%02d:%02d", jw_used->jadwalBel[i] / 100, jw_used->jadwalBel[i] % 100);
-    lv_table_set_cell_value_fmt(jw_lv_list_table, i + 1, 3, jw_used->belAudioFile[i]);
-  }
-  if (jw_used->jumlahBel == 0) {
-    lv_table_set_cell_value(jw_lv_list_table, 1, 0, "Tidak ada bel untuk hari ini");
-    lv_table_add_cell_ctrl(jw_lv_list_table, 1, 0, LV_TABLE_CELL_CTRL_MERGE_RIGHT);
-    lv_table_add_cell_ctrl(jw_lv_list_table, 1, 1, LV_TABLE_CELL_CTRL_MERGE_RIGHT);
-    lv_table_add_cell_ctrl(jw_lv_list_table, 1, 2, LV_TABLE_CELL_CTRL_MERGE_RIGHT);
-  }
+    bool changed = false;
+    snprintf(cell, sizeof(cell), "%d", i + 1);
+    changed |= lvc_table_set_cell(jw_lv_list_table, i + 1, 0, cell);
+    changed |= lvc_table_set_cell(jw_lv_list_table, i + 1, 1, jw_used->namaBel[i]);
+    snprintf(cell, sizeof(cell), "%02d:%02d", jw_used->jadwalBel[i] / 100, jw_used->jadwalBel[i] % 100);
+    changed |= lvc_table_set_cell(jw_lv_list_table, i + 1, 2, cell);
+    changed |= lvc_table_set_cell(jw_lv_list_table, i + 1, 3, jw_used->belAudioFile[i]);
+    changedRows += changed;
+  }
+  log_d("tabelJadwalHariIni %d of %d rows changed", changedRows, jw_used->jumlahBel);
   // End of create tabel jadwal box
 }
 
@@ -825,59 +1094,59 @@ void tj_table_build() {
   static const lv_coord_t tjListWidthDescriptor[] = { 44, 150, 100, 75, 75 };
   static const char* tjListHeader[] = { "#","Nama Template", "Tipe", "Aksi" };
   lv_obj_t* boxTab2 = lv_obj_get_child(tab2, 0);
-  if (lv_obj_get_child(boxTab2, 2) != NULL && lv_obj_get_child(boxTab2, 2) == tj_lv_list_table) {
-    log_d("deleting tj_lv_list_table because it already existed");
-    lv_obj_del(tj_lv_list_table);
-  }
-  tj_lv_list_table = lv_table_create(boxTab2); // Uses table to save memory
-  lv_obj_set_style_translate_y(tj_lv_list_table, 100, 0);
-  lv_obj_set_style_pad_all(tj_lv_list_table, 0, LV_PART_MAIN);
-  lv_obj_add_style(tj_lv_list_table, &style_noBorder, LV_PART_MAIN);
-  lv_obj_set_style_border_side(boxTab2, LV_BORDER_SIDE_BOTTOM, LV_PART_MAIN);
-  lv_obj_set_style_border_width(boxTab2, 1, LV_PART_MAIN);
-  lv_obj_set_height(tj_lv_list_table, LV_SIZE_CONTENT);
-  // Set the column and row beforehand to avoid memory reallocation later on
-  lv_table_set_col_cnt(tj_lv_list_table, 5);
-  lv_table_set_row_cnt(tj_lv_list_table, tj_total_active + 1);
-
-  lv_obj_set_style_pad_top(tj_lv_list_table, 8, LV_PART_ITEMS);
-  lv_obj_set_style_pad_bottom(tj_lv_list_table, 8, LV_PART_ITEMS);
-  lv_obj_set_style_pad_right(tj_lv_list_table, 0, LV_PART_ITEMS);
-  lv_obj_set_style_pad_left(tj_lv_list_table, 0, LV_PART_ITEMS);
-
-  lv_obj_set_style_text_align(tj_lv_list_table, LV_TEXT_ALIGN_CENTER, LV_PART_ITEMS | LV_STATE_DEFAULT);
-  lv_table_add_cell_ctrl(tj_lv_list_table, 0, 3, LV_TABLE_CELL_CTRL_MERGE_RIGHT);
-  for (int i = 0;i < 5;i++) {
-    if (i != 4)
-      lv_table_set_cell_value(tj_lv_list_table, 0, i, tjListHeader[i]);
-    lv_table_set_col_width(tj_lv_list_table, i, tjListWidthDescriptor[i]);
-  }
-
-  for (int i = 0; i < tj_total_active;i++) {
-    lv_table_set_cell_value_fmt(tj_lv_list_table, i + 1, 0, "%d", i + 1);
-    lv_table_set_cell_value_fmt(tj_lv_list_table, i + 1, 1, "%s", tj_lists[i].name);
-    lv_table_set_cell_value_fmt(tj_lv_list_table, i + 1, 2, "%s", tj_lists[i].tipeJadwal == TJ_MINGGUAN ? "Mingguan" : "Harian");
-    lv_table_set_cell_value_fmt(tj_lv_list_table, i + 1, 3, "");
-    lv_table_set_cell_value_fmt(tj_lv_list_table, i + 1, 4, "");
-  }
-
-  if (tj_total_active == 0) {
-    lv_table_set_cell_value(tj_lv_list_table, 1, 0, "Tidak ada template jadwal");
-    lv_table_add_cell_ctrl(tj_lv_list_table, 1, 0, LV_TABLE_CELL_CTRL_MERGE_RIGHT);
-    lv_table_add_cell_ctrl(tj_lv_list_table, 1, 1, LV_TABLE_CELL_CTRL_MERGE_RIGHT);
-    lv_table_add_cell_ctrl(tj_lv_list_table, 1, 2, LV_TABLE_CELL_CTRL_MERGE_RIGHT);
-  }
-  else {
+  // Create the table once per mainMenu, later calls only update the rows that differ
+  if (lv_obj_get_child(boxTab2, 2) == NULL || lv_obj_get_child(boxTab2, 2) != tj_lv_list_table) {
+    tj_lv_list_table = lv_table_create(boxTab2); // Uses table to save memory
+    lv_obj_set_style_translate_y(tj_lv_list_table, 100, 0);
+    lv_obj_set_style_pad_all(tj_lv_list_table, 0, LV_PART_MAIN);
+    lv_obj_add_style(tj_lv_list_table, &style_noBorder, LV_PART_MAIN);
+    lv_obj_set_style_border_side(boxTab2, LV_BORDER_SIDE_BOTTOM, LV_PART_MAIN);
+    lv_obj_set_style_border_width(boxTab2, 1, LV_PART_MAIN);
+    lv_obj_set_height(tj_lv_list_table, LV_SIZE_CONTENT);
+    // Set the column and row beforehand to avoid memory reallocation later on
+    lv_table_set_col_cnt(tj_lv_list_table, 5);
+    lv_table_set_row_cnt(tj_lv_list_table, tj_total_active ? tj_total_active + 1 : 2);
+
+    lv_obj_set_style_pad_top(tj_lv_list_table, 8, LV_PART_ITEMS);
+    lv_obj_set_style_pad_bottom(tj_lv_list_table, 8, LV_PART_ITEMS);
+    lv_obj_set_style_pad_right(tj_lv_list_table, 0, LV_PART_ITEMS);
+    lv_obj_set_style_pad_left(tj_lv_list_table, 0, LV_PART_ITEMS);
+
+    lv_obj_set_style_text_align(tj_lv_list_table, LV_TEXT_ALIGN_CENTER, LV_PART_ITEMS | LV_STATE_DEFAULT);
+    lv_table_add_cell_ctrl(tj_lv_list_table, 0, 3, LV_TABLE_CELL_CTRL_MERGE_RIGHT);
+    for (int i = 0;i < 5;i++) {
+      if (i != 4)
+        lv_table_set_cell_value(tj_lv_list_table, 0, i, tjListHeader[i]);
+      lv_table_set_col_width(tj_lv_list_table, i, tjListWidthDescriptor[i]);
+    }
+    // The callbacks ignore the "no template" row, so they can stay while the list is empty
     lv_obj_add_event_cb(tj_lv_list_table, tj_table_draw_cb, LV_EVENT_DRAW_PART_END, NULL); // Callback used to draw the pseudo button on the table (table can't draw object)
     lv_obj_add_event_cb(tj_lv_list_table, tj_table_actionBtn_cb, LV_EVENT_VALUE_CHANGED, NULL); // Callback for action button click
     lv_obj_add_event_cb(tj_lv_list_table, tj_table_refresh_cb, LV_EVENT_REFRESH, NULL); // Callback for action button click
   }
+  else if (lv_table_get_row_cnt(tj_lv_list_table) != (tj_total_active ? tj_total_active + 1 : 2))
+    lv_table_set_row_cnt(tj_lv_list_table, tj_total_active ? tj_total_active + 1 : 2);
+
+  lvc_table_set_empty_row(tj_lv_list_table, tj_total_active == 0, "Tidak ada template jadwal");
+  char cell[16];
+  int changedRows = 0;
+  for (int i = 0; i < tj_total_active;i++) {
+    bool changed = false;
+    snprintf(cell, sizeof(cell), "%d", i + 1);
+    changed |= lvc_table_set_cell(tj_lv_list_table, i + 1, 0, cell);
+    changed |= lvc_table_set_cell(tj_lv_list_table, i + 1, 1, tj_lists[i].name);
+    changed |= lvc_table_set_cell(tj_lv_list_table, i + 1, 2, tj_lists[i].tipeJadwal == TJ_MINGGUAN ? "Mingguan" : "Harian");
+    changedRows += changed;
+  }
+  log_d("tj_table_build %d of %d rows changed", changedRows, tj_total_active);
 }
 
 void tj_table_refresh_cb(lv_event_t* e) {
   lv_obj_t* table = (lv_obj_t*)lv_event_get_target(e);
   WidgetParameterData* mdc = (WidgetParameterData*)lv_event_get_param(e);
   int row = *(int*)(mdc->param);
+  if (row < 1 || row > tj_total_active)
+    return;
   templateJadwal_delete(&tj_lists[row - 1]);
   tj_table_build();
 }
@@ -887,7 +1156,7 @@ void tj_table_actionBtn_cb(lv_event_t* e) {
   uint16_t col;
   uint16_t row;
   lv_table_get_selected_cell(obj, &row, &col);
-  if (row == 0)
+  if (row == 0 || tj_total_active == 0)
     return;
   if (col == 3) { // Edit button
     TemplateJadwalBuilder::create(row);
@@ -907,7 +1176,7 @@ void tj_table_draw_cb(lv_event_t* e) {
   // id = current row × col count + current column
   uint32_t row = dsc->id / lv_table_get_col_cnt(obj);
   uint32_t col = dsc->id - row * lv_table_get_col_cnt(obj);
-  if (dsc->part == LV_PART_ITEMS && col >= 3 && row > 0) { // Draw the button only on column 3 of table and row > 0
+  if (dsc->part == LV_PART_ITEMS && col >= 3 && row > 0 && tj_total_active > 0) { // Draw the button only on column 3 of table and row > 0
     lv_draw_rect_dsc_t rect_dsc;
     lv_draw_label_dsc_t label_dsc;
     lv_draw_label_dsc_init(&label_dsc);
@@ -943,7 +1212,9 @@ void tj_ganti_template_btn_cb(lv_event_t* e) {
     *str++ = c;
     *str++ = 0;
   };
-  char options[TJ_MAX_LEN * FS_MAX_NAME_LEN + 20] = { 0 };
+  char* options = (char*)calloc(tj_total_active * FS_MAX_NAME_LEN + 1, 1); // Roller copies the options, so it's freed below
+  if (options == NULL)
+    return;
   int selectedIdx = 0;
   lv_obj_t* overlay = lvc_create_overlay();
 
@@ -970,6 +1241,7 @@ void tj_ganti_template_btn_cb(lv_event_t* e) {
   lv_obj_align(modalRoller, LV_ALIGN_CENTER, 0, -10);
   lv_roller_set_options(modalRoller, options, LV_ROLLER_MODE_NORMAL);
   lv_roller_set_selected(modalRoller, selectedIdx, LV_ANIM_OFF);
+  free(options);
 
   lv_obj_t* modalButton = lv_btn_create(modal);
   lvc_btn_init(modalButton, "Pilih", LV_ALIGN_BOTTOM_LEFT, 50, 0, &lv_font_montserrat_12);
@@ -979,7 +1251,7 @@ void tj_ganti_template_btn_cb(lv_event_t* e) {
     lv_obj_t* modalRoller = (lv_obj_t*)lv_event_get_user_data(event);
     int selectedIdx = lv_roller_get_selected(modalRoller);
 
-    if (strcmp(tj_lists[selectedIdx].name, tj_used.name) != 0) // Only change tj_used if selected value is not the index of tj_used
+    if (selectedIdx < tj_total_active && strcmp(tj_lists[selectedIdx].name, tj_used.name) != 0) // Only change tj_used if selected value is not the index of tj_used
       templateJadwal_changeUsedTJ(tj_lists[selectedIdx], true, true);
 
     lv_obj_del(overlay);
@@ -994,174 +1266,167 @@ void tj_ganti_template_btn_cb(lv_event_t* e) {
 
 }
 
-void belManual_btn_cb(lv_event_t* e) {
-  lv_obj_t* obj = lv_event_get_target(e); // Atur Bel Manual button object
+void belManual_btn_cb(lv_event_t* e) { // e isn't used, ui_benchmark() call it with NULL
+  PooledModal* pm = &modalPool_belManual;
 
-  lv_obj_t* overlay = lvc_create_overlay(); // Create overlay
+  if (pm->overlay == NULL) { // Built on first open only, then kept hidden on lv_layer_top()
+    lvgl_mem_scope_begin(lvMemScopes[LVMEM_BEL_MANUAL]);
+    pm->overlay = lvc_create_overlay(lv_layer_top());
+    lv_obj_add_flag(pm->overlay, LV_OBJ_FLAG_HIDDEN); // Until modalPool_open()
+    lv_obj_set_user_data(pm->overlay, pm);
 
-  lv_obj_remove_event_cb(regularKeyboard, kb_event_cb);
-  lv_obj_add_event_cb(regularKeyboard, kb_event_cb, LV_EVENT_ALL, overlay);
+    pm->modal = lv_obj_create(pm->overlay); // Create modal
+    lv_obj_set_size(pm->modal, lv_pct(100), lv_pct(100)); // Most fit number
+    lv_obj_align(pm->modal, LV_ALIGN_CENTER, 0, 0);
 
-  lv_obj_t* modal = lv_obj_create(overlay); // Create modal
-  lv_obj_set_size(modal, lv_pct(100), lv_pct(100)); // Most fit number
-  lv_obj_align(modal, LV_ALIGN_CENTER, 0, 0);
+    pm->title = lv_label_create(pm->modal);
+    lvc_label_init(pm->title, &lv_font_montserrat_20, LV_ALIGN_TOP_LEFT, 0, 7);
+    lv_label_set_text_static(pm->title, "Atur Bel Manual");
 
-  lv_obj_t* modalTitle = lv_label_create(modal);
-  lvc_label_init(modalTitle, &lv_font_montserrat_20, LV_ALIGN_TOP_LEFT, 0, 7);
-  lv_label_set_text_static(modalTitle, "Atur Bel Manual");
+    pm->cancelButton = lv_btn_create(pm->modal); // Modal cancel button
+    lvc_btn_init(pm->cancelButton, "Batal", LV_ALIGN_TOP_RIGHT, 0, 0);
+    lv_obj_add_event_cb(pm->cancelButton, [](lv_event_t* e) {
+      modalPool_close(&modalPool_belManual);
+      }, LV_EVENT_CLICKED, NULL);
 
-  lv_obj_t* modalButton = lv_btn_create(modal); // Modal cancel button
-  lvc_btn_init(modalButton, "Batal", LV_ALIGN_TOP_RIGHT, 0, 0);
-  lv_obj_add_event_cb(modalButton, [](lv_event_t* e) {
-    lv_obj_t* btn = lv_event_get_target(e);
-    lv_obj_del(lv_obj_get_parent(lv_obj_get_parent(btn)));
-    }, LV_EVENT_CLICKED, NULL);
+    pm->okButton = lv_btn_create(pm->modal); // Modal save button
+    lvc_btn_init(pm->okButton, "Simpan", LV_ALIGN_TOP_RIGHT, -80, 0);
+    lv_obj_add_event_cb(pm->okButton, [](lv_event_t* e) {
+      lv_obj_t* btn = lv_event_get_target(e);
+      lv_obj_t* modal = lv_obj_get_parent(btn);
+      for (int i = 3;i <= 6;i++) { // modalContent is 4th to 7th child of modal
+        lv_obj_t* modalContent = lv_obj_get_child(modal, i);
+        lv_obj_t* checkbox = lv_obj_get_child(modalContent, 1); // checkbox is 2nd child of modalContent
+        lv_obj_t* belName = lv_obj_get_child(modalContent, 3); // belName is 4nd child of modalContent
+        lv_obj_t* audioButton = lv_obj_get_child(modalContent, 5); // audioButton is 6nd child of modalContent
+        belManual[i - 3].enabled = lv_obj_has_state(checkbox, LV_STATE_CHECKED);
+        strcpy(belManual[i - 3].name, lv_textarea_get_text(belName));
+        strcpy(belManual[i - 3].audioFile, lv_label_get_text(lv_obj_get_child(audioButton, 0)));
+
+        // No need to set the button text, because it's already pointing to belName[].name char pointer
+        // But need to enable/disable button according to checkbox value
+        if (!belManual[i - 3].enabled)
+          lv_obj_add_state(belManual_btn_pointer[i - 3], LV_STATE_DISABLED);
+        else
+          lv_obj_clear_state(belManual_btn_pointer[i - 3], LV_STATE_DISABLED);
+      }
+      modalPool_close(&modalPool_belManual);
+      belManual_store(belManual, belManual_len);
+      }, LV_EVENT_CLICKED, NULL);
 
-  modalButton = lv_btn_create(modal); // Modal save button
-  lvc_btn_init(modalButton, "Simpan", LV_ALIGN_TOP_RIGHT, -80, 0);
-  lv_obj_add_event_cb(modalButton, [](lv_event_t* e) {
-    lv_obj_t* btn = lv_event_get_target(e);
-    lv_obj_t* modal = lv_obj_get_parent(btn);
-    for (int i = 3;i <= 6;i++) { // modalContent is 4th to 7th child of modal
-      lv_obj_t* modalContent = lv_obj_get_child(modal, i);
-      lv_obj_t* checkbox = lv_obj_get_child(modalContent, 1); // checkbox is 2nd child of modalContent
-      lv_obj_t* belName = lv_obj_get_child(modalContent, 3); // belName is 4nd child of modalContent
-      lv_obj_t* audioButton = lv_obj_get_child(modalContent, 5); // audioButton is 6nd child of modalContent
-      belManual[i - 3].enabled = lv_obj_has_state(checkbox, LV_STATE_CHECKED);
-      strcpy(belManual[i - 3].name, lv_textarea_get_text(belName));
-      strcpy(belManual[i - 3].audioFile, lv_label_get_text(lv_obj_get_child(audioButton, 0)));
-
-      // No need to set the button text, because it's already pointing to belName[].name char pointer
-      // But need to enable/disable button according to checkbox value
-      if (!belManual[i - 3].enabled)
-        lv_obj_add_state(belManual_btn_pointer[i - 3], LV_STATE_DISABLED);
-      else
-        lv_obj_clear_state(belManual_btn_pointer[i - 3], LV_STATE_DISABLED);
+    // Create 4 container for checkbox, name textarea, and file audio choose button for each bel manual instance
+    for (int i = 0;i < 4;i++) {
+      lv_obj_t* modalContent = lv_obj_create(pm->modal); // Create container for bel manual contents
+      lv_obj_set_size(modalContent, lv_pct(100), 55);
+      lv_obj_set_style_pad_all(modalContent, 0, 0);
+      lv_obj_align(modalContent, LV_ALIGN_TOP_MID, 0, 50 + (60 * i));
+      lv_obj_add_style(modalContent, &style_noBorder, 0);
+      lv_obj_add_flag(modalContent, LV_OBJ_FLAG_OVERFLOW_VISIBLE);
+
+      // Number descriptor of the container
+      lv_obj_t* label = lv_label_create(modalContent);
+      lvc_label_init(label, &lv_font_montserrat_24, LV_ALIGN_LEFT_MID, 10, -1);
+      lv_label_set_text_fmt(label, "%d", i + 1);
+
+      // Checkbox of the belmanual
+      lv_obj_t* checkbox = lv_checkbox_create(modalContent);
+      lv_checkbox_set_text_static(checkbox, "");
+      lv_obj_align(checkbox, LV_ALIGN_LEFT_MID, 30, 0);
+      lv_obj_set_style_bg_color(checkbox, bs_indigo_500, LV_PART_INDICATOR | LV_STATE_CHECKED);
+      lv_obj_set_style_border_color(checkbox, bs_indigo_500, LV_PART_INDICATOR);
+      lv_obj_update_layout(checkbox); // Make sure the layour is updated
+      label = lv_label_create(modalContent); // Label for checkbox
+      lv_obj_align_to(label, checkbox, LV_ALIGN_OUT_TOP_LEFT, -5, 0);
+      lv_obj_set_style_text_font(label, &lv_font_montserrat_12, 0);
+      lv_label_set_text_static(label, "Aktif");
+
+      // Textarea for bel name
+      lv_obj_t* belName = lv_textarea_create(modalContent);
+      lv_textarea_set_max_length(belName, FS_MAX_NAME_LEN - 1); // Maximum input text length of the belName is 32
+      lv_textarea_set_one_line(belName, true);
+      lv_obj_align(belName, LV_ALIGN_CENTER, -50, 0);
+      lv_obj_set_width(belName, lv_pct(40));
+      lv_obj_set_style_pad_all(belName, 5, LV_PART_MAIN);
+      label = lv_label_create(modalContent); // Label for textarea
+      lv_obj_align_to(label, belName, LV_ALIGN_OUT_TOP_LEFT, 0, 0);
+      lv_obj_set_style_text_font(label, &lv_font_montserrat_12, 0);
+      lv_label_set_text_static(label, "Nama Bel");
+      lv_obj_add_event_cb(belName, [](lv_event_t* e) { // Text area focus/defocus event (show/hide keyboard)
+        lv_event_code_t code = lv_event_get_code(e);
+        lv_obj_t* ta = lv_event_get_target(e);
+        lv_obj_t* kb = regularKeyboard; // Not the event user data, keyboard is recreated with mainMenu but this modal is kept
+        lv_obj_t* cont = lv_obj_get_parent(lv_obj_get_parent(lv_obj_get_parent(ta)));
+        if (code == LV_EVENT_FOCUSED) {
+          lv_obj_set_height(cont, LV_VER_RES - lv_obj_get_height(kb));
+          lv_obj_update_layout(cont);   /*Be sure the sizes are recalculated*/
+          lv_obj_scroll_to_view_recursive(ta, LV_ANIM_OFF);
+          lv_keyboard_set_textarea(kb, ta);
+          lv_obj_clear_flag(kb, LV_OBJ_FLAG_HIDDEN);
+        }
+
+        if (code == LV_EVENT_DEFOCUSED) {
+          lv_keyboard_set_textarea(kb, NULL);
+          lv_obj_set_height(cont, LV_VER_RES);
+          lv_obj_add_flag(kb, LV_OBJ_FLAG_HIDDEN);
+        }}, LV_EVENT_ALL, NULL);
+
+      // Button for choosing audio file
+      lv_obj_t* audioButton = lv_btn_create(modalContent);
+      lvc_btn_init(audioButton, "", LV_ALIGN_RIGHT_MID, 0, 0, &lv_font_montserrat_14, bs_indigo_500, bs_white, LV_TEXT_ALIGN_CENTER, LV_LABEL_LONG_SCROLL, lv_pct(100), lv_pct(40));
+      lv_obj_set_style_pad_all(audioButton, 6, 0);
+      lv_obj_add_event_cb(audioButton, [](lv_event_t* e) { // Open traverser when button clicked
+        lv_obj_t* btn = lv_event_get_target(e);
+        Traverser::createTraverser(btn, "/"); // The returned value of traverser will be saved on REFRESH event of the issuer
+        }, LV_EVENT_CLICKED, NULL);
+      lv_obj_add_event_cb(audioButton, [](lv_event_t* e) { // Store the returned value from traverser to the label of audioButton
+        lv_obj_t* label = lv_obj_get_child(lv_event_get_target(e), 0);
+        char* traverserValue = (char*)lv_event_get_param(e);
+        if (strlen(traverserValue) > 0) // Only store when it's not empty, or traverser is not cancelled
+          lv_label_set_text(label, traverserValue); // Need to use non-static, because traverser return char* that might be changed on next traverser call
+        }, LV_EVENT_REFRESH, NULL);
+      label = lv_label_create(modalContent); // Label for audio file
+      lv_obj_align_to(label, audioButton, LV_ALIGN_OUT_TOP_LEFT, 0, 0);
+      lv_obj_set_style_text_font(label, &lv_font_montserrat_12, 0);
+      lv_label_set_text_static(label, "File Audio");
     }
-    lv_obj_del(lv_obj_get_parent(modal));
-    belManual_store(belManual, belManual_len);
-    }, LV_EVENT_CLICKED, NULL);
+    lvgl_mem_scope_end(lvMemScopes[LVMEM_BEL_MANUAL], pm->overlay);
+  }
+
+  lv_obj_remove_event_cb(regularKeyboard, kb_event_cb);
+  lv_obj_add_event_cb(regularKeyboard, kb_event_cb, LV_EVENT_ALL, pm->overlay);
 
-  // Create 4 container for checkbox, name textarea, and file audio choose button for each bel manual instance
+  // Fill the kept widgets with current belManual values, the previous open may have been cancelled
   for (int i = 0;i < 4;i++) {
-    lv_obj_t* modalContent = lv_obj_create(modal); // Create container for bel manual contents
-    lv_obj_set_size(modalContent, lv_pct(100), 55);
-    lv_obj_set_style_pad_all(modalContent, 0, 0);
-    lv_obj_align(modalContent, LV_ALIGN_TOP_MID, 0, 50 + (60 * i));
-    lv_obj_add_style(modalContent, &style_noBorder, 0);
-    lv_obj_add_flag(modalContent, LV_OBJ_FLAG_OVERFLOW_VISIBLE);
-
-    // Number descriptor of the container
-    lv_obj_t* label = lv_label_create(modalContent);
-    lvc_label_init(label, &lv_font_montserrat_24, LV_ALIGN_LEFT_MID, 10, -1);
-    lv_label_set_text_fmt(label, "%d", i + 1);
-
-    // Checkbox of the belmanual
-    lv_obj_t* checkbox = lv_checkbox_create(modalContent);
-    lv_checkbox_set_text_static(checkbox, "");
-    lv_obj_align(checkbox, LV_ALIGN_LEFT_MID, 30, 0);
-    lv_obj_set_style_bg_color(checkbox, bs_indigo_500, LV_PART_INDICATOR | LV_STATE_CHECKED);
-    lv_obj_set_style_border_color(checkbox, bs_indigo_500, LV_PART_INDICATOR);
+    lv_obj_t* modalContent = lv_obj_get_child(pm->modal, i + 3);
     if (belManual[i].enabled) // Change the checkbox tick based on belManual value
-      lv_obj_add_state(checkbox, LV_STATE_CHECKED);
-    lv_obj_update_layout(checkbox); // Make sure the layour is updated
-    label = lv_label_create(modalContent); // Label for checkbox
-    lv_obj_align_to(label, checkbox, LV_ALIGN_OUT_TOP_LEFT, -5, 0);
-    lv_obj_set_style_text_font(label, &lv_font_montserrat_12, 0);
-    lv_label_set_text_static(label, "Aktif");
-
-    // Textarea for bel name
-    lv_obj_t* belName = lv_textarea_create(modalContent);
-    lv_textarea_set_max_length(belName, FS_MAX_NAME_LEN - 1); // Maximum input text length of the belName is 32
-    lv_textarea_set_one_line(belName, true);
-    lv_textarea_set_text(belName, belManual[i].name);
-    lv_obj_align(belName, LV_ALIGN_CENTER, -50, 0);
-    lv_obj_set_width(belName, lv_pct(40));
-    lv_obj_set_style_pad_all(belName, 5, LV_PART_MAIN);
-    label = lv_label_create(modalContent); // Label for textarea
-    lv_obj_align_to(label, belName, LV_ALIGN_OUT_TOP_LEFT, 0, 0);
-    lv_obj_set_style_text_font(label, &lv_font_montserrat_12, 0);
-    lv_label_set_text_static(label, "Nama Bel");
-    lv_obj_add_event_cb(belName, [](lv_event_t* e) { // Text area focus/defocus event (show/hide keyboard)
-      lv_event_code_t code = lv_event_get_code(e);
-      lv_obj_t* ta = lv_event_get_target(e);
-      lv_obj_t* kb = (lv_obj_t*)lv_event_get_user_data(e);
-      lv_obj_t* cont = lv_obj_get_parent(lv_obj_get_parent(lv_obj_get_parent(ta)));
-      if (code == LV_EVENT_FOCUSED) {
-        lv_obj_set_height(cont, LV_VER_RES - lv_obj_get_height(kb));
-        lv_obj_update_layout(cont);   /*Be sure the sizes are recalculated*/
-        lv_obj_scroll_to_view_recursive(ta, LV_ANIM_OFF);
-        lv_keyboard_set_textarea(kb, ta);
-        lv_obj_clear_flag(kb, LV_OBJ_FLAG_HIDDEN);
-      }
-
-      if (code == LV_EVENT_DEFOCUSED) {
-        lv_keyboard_set_textarea(kb, NULL);
-        lv_obj_set_height(cont, LV_VER_RES);
-        lv_obj_add_flag(kb, LV_OBJ_FLAG_HIDDEN);
-      }}, LV_EVENT_ALL, regularKeyboard);
-
-    // Button for choosing audio file
-    lv_obj_t* audioButton = lv_btn_create(modalContent);
-    lvc_btn_init(audioButton, belManual[i].audioFile, LV_ALIGN_RIGHT_MID, 0, 0, &lv_font_montserrat_14, bs_indigo_500, bs_white, LV_TEXT_ALIGN_CENTER, LV_LABEL_LONG_SCROLL, lv_pct(100), lv_pct(40));
-    lv_obj_set_style_pad_all(audioButton, 6, 0);
-    lv_obj_add_event_cb(audioButton, [](lv_event_t* e) { // Open traverser when button clicked
-      lv_obj_t* btn = lv_event_get_target(e);
-      Traverser::createTraverser(btn, "/"); // The returned value of traverser will be saved on REFRESH event of the issuer
-      }, LV_EVENT_CLICKED, NULL);
-    lv_obj_add_event_cb(audioButton, [](lv_event_t* e) { // Store the returned value from traverser to the label of audioButton
-      lv_obj_t* label = lv_obj_get_child(lv_event_get_target(e), 0);
-      char* traverserValue = (char*)lv_event_get_param(e);
-      if (strlen(traverserValue) > 0) // Only store when it's not empty, or traverser is not cancelled
-        lv_label_set_text(label, traverserValue); // Need to use non-static, because traverser return char* that might be changed on next traverser call
-      }, LV_EVENT_REFRESH, NULL);
-    label = lv_label_create(modalContent); // Label for audio file
-    lv_obj_align_to(label, audioButton, LV_ALIGN_OUT_TOP_LEFT, 0, 0);
-    lv_obj_set_style_text_font(label, &lv_font_montserrat_12, 0);
-    lv_label_set_text_static(label, "File Audio");
+      lv_obj_add_state(lv_obj_get_child(modalContent, 1), LV_STATE_CHECKED);
+    else
+      lv_obj_clear_state(lv_obj_get_child(modalContent, 1), LV_STATE_CHECKED);
+    lv_textarea_set_text(lv_obj_get_child(modalContent, 3), belManual[i].name);
+    lv_label_set_text(lv_obj_get_child(lv_obj_get_child(modalContent, 5), 0), belManual[i].audioFile);
   }
+  lv_obj_set_height(pm->overlay, LV_VER_RES);
+  lv_obj_scroll_to_y(pm->modal, 0, LV_ANIM_OFF);
+  modalPool_open(pm);
 }
 
+// Open a roller picker, options must stay valid like lv_label_set_text_static() since the roller
+// options are only copied again when a different pointer is passed
 lv_obj_t* rollpick_create(WidgetParameterData* wpd, const char* headerTitle, const char* options, const lv_font_t* headerFont, lv_coord_t width, lv_coord_t height) {
-  lv_obj_t* overlay = lvc_create_overlay();
-
-  lv_obj_t* modal = lv_obj_create(overlay);
-  lv_obj_set_size(modal, width, height); // Most fit number
-  lv_obj_align(modal, LV_ALIGN_CENTER, 0, 0);
-
-  lv_obj_t* modalTitle = lv_label_create(modal);
-  lvc_label_init(modalTitle, headerFont, LV_ALIGN_TOP_LEFT, 0, -5);
-  lv_label_set_text_static(modalTitle, headerTitle);
-
-  lv_obj_t* modalRoller = lv_roller_create(modal);
-  lv_roller_set_options(modalRoller, options, LV_ROLLER_MODE_NORMAL);
-  lv_obj_set_width(modalRoller, lv_pct(100));
-  lv_roller_set_visible_row_count(modalRoller, 3);
-  lv_obj_set_style_bg_color(modalRoller, bs_indigo_700, LV_PART_SELECTED);
-  lv_obj_align(modalRoller, LV_ALIGN_CENTER, 0, -10);
-
-  lv_obj_t* modalButton = lv_btn_create(modal);
-  lvc_btn_init(modalButton, "Pilih", LV_ALIGN_BOTTOM_LEFT, 50, 0, &lv_font_montserrat_12);
-  lv_obj_add_event_cb(modalButton, [](lv_event_t* event) {
-    lv_obj_t* clickedBtn = lv_event_get_target(event);
-    lv_obj_t* modal = lv_obj_get_parent(clickedBtn);
-    lv_obj_t* overlay = lv_obj_get_parent(modal);
-    lv_obj_t* modalRoller = lv_obj_get_child(modal, 1);
-    WidgetParameterData* wpd = (WidgetParameterData*)lv_event_get_user_data(event);
-    *(uint16_t*)wpd->param = lv_roller_get_selected(modalRoller);
-    // Get selected roller value
-    lv_event_send(wpd->issuer, LV_EVENT_REFRESH, wpd);
-    // Exit from modal
-    lv_obj_del(overlay);
-    }, LV_EVENT_CLICKED, wpd);
-
-  modalButton = lv_btn_create(modal);
-  lvc_btn_init(modalButton, "Batal", LV_ALIGN_BOTTOM_RIGHT, -50, 0, &lv_font_montserrat_12);
-  lv_obj_add_event_cb(modalButton, [](lv_event_t* event) {
-    void* ovl = lv_event_get_user_data(event);
-    lv_obj_del((lv_obj_t*)ovl);
-    }, LV_EVENT_CLICKED, overlay);
-  return modalRoller;
+  PooledModal* pm = modalPool_acquire(modalPool_rollpick, MODAL_POOL_ROLLPICK_CNT);
+  if (pm == NULL)
+    return NULL;
+  pm->wpd = wpd;
+  lv_obj_set_size(pm->modal, width, height);
+  lv_obj_set_style_text_font(pm->title, headerFont, 0);
+  lv_label_set_text_static(pm->title, headerTitle);
+  if (pm->options != options) {
+    lv_roller_set_options(pm->content, options, LV_ROLLER_MODE_NORMAL);
+    pm->options = options;
+  }
+  lv_roller_set_selected(pm->content, 0, LV_ANIM_OFF);
+  modalPool_open(pm);
+  return pm->content;
 }
 
 // Function to add copy/paste capability on keyboard on top of default keyboard callback
@@ -1205,43 +1470,141 @@ void kb_event_cb(lv_event_t* e) {
 
 lv_obj_t* modal_create_confirm(WidgetParameterData* modalConfirmData, const char* message, const char* headerText, const lv_font_t* headerFont, const lv_font_t* messageFont, lv_color_t headerTextColor, lv_color_t textColor, lv_color_t headerColor, const char* confirmButtonText, const char* cancelButtonText, lv_coord_t xSize, lv_coord_t ySize) {
   lv_obj_t* modal = modal_create_alert(message, headerText, headerFont, messageFont, headerTextColor, textColor, headerColor, cancelButtonText, xSize, ySize);
-  lv_obj_t* okButton = lv_btn_create(modal);
-  lvc_btn_init(okButton, confirmButtonText, LV_ALIGN_BOTTOM_RIGHT, -120, -15);
-  lv_obj_add_event_cb(okButton, [](lv_event_t* e) {
-    WidgetParameterData* modalConfirmData = (WidgetParameterData*)lv_event_get_user_data(e);
-    lv_obj_t* btn = lv_event_get_target(e);
-    lv_event_send(modalConfirmData->issuer, LV_EVENT_REFRESH, modalConfirmData);
-    lv_obj_del(lv_obj_get_parent(lv_obj_get_parent(btn)));
-    }, LV_EVENT_CLICKED, modalConfirmData);
+  if (modal == NULL)
+    return NULL;
+  PooledModal* pm = (PooledModal*)lv_obj_get_user_data(lv_obj_get_parent(modal));
+  pm->wpd = modalConfirmData;
+  lv_label_set_text_static(lv_obj_get_child(pm->okButton, 0), confirmButtonText);
+  lv_obj_clear_flag(pm->okButton, LV_OBJ_FLAG_HIDDEN);
   return modal;
 }
 
 lv_obj_t* modal_create_alert(const char* message, const char* headerText, const lv_font_t* headerFont, const lv_font_t* messageFont, lv_color_t headerTextColor, lv_color_t textColor, lv_color_t headerColor, const char* buttonText, lv_coord_t xSize, lv_coord_t ySize) {
-  lv_obj_t* overlay = lvc_create_overlay();
+  PooledModal* pm = modalPool_acquire(modalPool_alert, MODAL_POOL_ALERT_CNT);
+  if (pm == NULL)
+    return NULL;
+  lv_obj_set_size(pm->modal, xSize, ySize);
+  lv_obj_set_style_bg_color(pm->header, headerColor, 0);
+  lv_obj_set_style_text_color(pm->title, headerTextColor, 0);
+  lv_label_set_text_static(pm->title, headerText);
+  lv_obj_set_style_text_color(pm->content, textColor, 0);
+  lv_label_set_text_static(pm->content, message);
+  lv_label_set_text_static(lv_obj_get_child(pm->cancelButton, 0), buttonText);
+  lv_obj_add_flag(pm->okButton, LV_OBJ_FLAG_HIDDEN);
+  modalPool_open(pm);
+  return pm->modal;
+}
 
-  lv_obj_t* modal = lv_obj_create(overlay);
-  lv_obj_center(modal);
-  lv_obj_set_size(modal, xSize, ySize);
-  lv_obj_set_style_pad_all(modal, 0, 0);
+// Build the alert/confirm and rollpick skeletons once, so opening a dialog doesn't allocate from
+// the LVGL heap. Bel manual modal is built on its first open, it's only reachable from mainMenu
+void modalPool_init() {
+  lvgl_mem_scope_begin(lvMemScopes[LVMEM_MODAL_POOL]);
+  for (uint8_t i = 0; i < MODAL_POOL_ALERT_CNT; i++) {
+    PooledModal* pm = &modalPool_alert[i];
+    pm->overlay = lvc_create_overlay(lv_layer_top());
+    lv_obj_add_flag(pm->overlay, LV_OBJ_FLAG_HIDDEN); // Until modalPool_open()
+    lv_obj_set_user_data(pm->overlay, pm);
+
+    pm->modal = lv_obj_create(pm->overlay);
+    lv_obj_center(pm->modal);
+    lv_obj_set_style_pad_all(pm->modal, 0, 0);
+
+    pm->header = lv_obj_create(pm->modal);
+    lv_obj_align(pm->header, LV_ALIGN_TOP_MID, 0, 0);
+    lv_obj_set_size(pm->header, lv_pct(100), LV_SIZE_CONTENT);
+    lv_obj_add_style(pm->header, &style_zeroRadius, 0);
+
+    pm->title = lv_label_create(pm->header);
+    lvc_label_init(pm->title, &lv_font_montserrat_20, LV_ALIGN_TOP_LEFT, 0, 0, bs_dark, LV_TEXT_ALIGN_LEFT, LV_LABEL_LONG_WRAP, lv_pct(100));
+
+    pm->content = lv_label_create(pm->modal);
+    lvc_label_init(pm->content, &lv_font_montserrat_14, LV_ALIGN_CENTER, 0, 0, bs_dark, LV_TEXT_ALIGN_CENTER, LV_LABEL_LONG_WRAP, lv_pct(100));
+
+    pm->cancelButton = lv_btn_create(pm->modal);
+    lvc_btn_init(pm->cancelButton, "", LV_ALIGN_BOTTOM_RIGHT, -15, -15);
+    lv_obj_add_event_cb(pm->cancelButton, [](lv_event_t* e) {
+      modalPool_close((PooledModal*)lv_event_get_user_data(e));
+      }, LV_EVENT_CLICKED, pm);
+
+    pm->okButton = lv_btn_create(pm->modal); // Only shown by modal_create_confirm()
+    lvc_btn_init(pm->okButton, "", LV_ALIGN_BOTTOM_RIGHT, -120, -15);
+    lv_obj_add_event_cb(pm->okButton, [](lv_event_t* e) {
+      PooledModal* pm = (PooledModal*)lv_event_get_user_data(e);
+      lv_event_send(pm->wpd->issuer, LV_EVENT_REFRESH, pm->wpd);
+      modalPool_close(pm);
+      }, LV_EVENT_CLICKED, pm);
+  }
+
+  for (uint8_t i = 0; i < MODAL_POOL_ROLLPICK_CNT; i++) {
+    PooledModal* pm = &modalPool_rollpick[i];
+    pm->overlay = lvc_create_overlay(lv_layer_top());
+    lv_obj_add_flag(pm->overlay, LV_OBJ_FLAG_HIDDEN); // Until modalPool_open()
+    lv_obj_set_user_data(pm->overlay, pm);
+
+    pm->modal = lv_obj_create(pm->overlay);
+    lv_obj_align(pm->modal, LV_ALIGN_CENTER, 0, 0);
+
+    pm->title = lv_label_create(pm->modal);
+    lvc_label_init(pm->title, &lv_font_montserrat_20, LV_ALIGN_TOP_LEFT, 0, -5);
+
+    pm->content = lv_roller_create(pm->modal);
+    lv_obj_set_width(pm->content, lv_pct(100));
+    lv_roller_set_visible_row_count(pm->content, 3);
+    lv_obj_set_style_bg_color(pm->content, bs_indigo_700, LV_PART_SELECTED);
+    lv_obj_align(pm->content, LV_ALIGN_CENTER, 0, -10);
+
+    pm->okButton = lv_btn_create(pm->modal);
+    lvc_btn_init(pm->okButton, "Pilih", LV_ALIGN_BOTTOM_LEFT, 50, 0, &lv_font_montserrat_12);
+    lv_obj_add_event_cb(pm->okButton, [](lv_event_t* e) {
+      PooledModal* pm = (PooledModal*)lv_event_get_user_data(e);
+      // Get selected roller value
+      *(uint16_t*)pm->wpd->param = lv_roller_get_selected(pm->content);
+      lv_event_send(pm->wpd->issuer, LV_EVENT_REFRESH, pm->wpd);
+      // Exit from modal
+      modalPool_close(pm);
+      }, LV_EVENT_CLICKED, pm);
+
+    pm->cancelButton = lv_btn_create(pm->modal);
+    lvc_btn_init(pm->cancelButton, "Batal", LV_ALIGN_BOTTOM_RIGHT, -50, 0, &lv_font_montserrat_12);
+    lv_obj_add_event_cb(pm->cancelButton, [](lv_event_t* e) {
+      modalPool_close((PooledModal*)lv_event_get_user_data(e));
+      }, LV_EVENT_CLICKED, pm);
+  }
+  lvgl_mem_scope_end(lvMemScopes[LVMEM_MODAL_POOL], lv_layer_top()); // Kept until reboot
+}
 
-  lv_obj_t* modalHeader = lv_obj_create(modal);
-  lv_obj_align(modalHeader, LV_ALIGN_TOP_MID, 0, 0);
-  lv_obj_set_size(modalHeader, lv_pct(100), LV_SIZE_CONTENT);
-  lv_obj_add_style(modalHeader, &style_zeroRadius, 0);
-  lv_obj_set_style_bg_color(modalHeader, headerColor, 0);
+// Return the first free modal of the pool, NULL if all of them are open
+PooledModal* modalPool_acquire(PooledModal* pool, uint8_t count) {
+  for (uint8_t i = 0; i < count; i++)
+    if (!pool[i].used && pool[i].overlay)
+      return &pool[i];
+  log_e("No free modal in pool");
+  return NULL;
+}
 
-  lv_obj_t* warningLabel = lv_label_create(modalHeader);
-  lvc_label_init(warningLabel, &lv_font_montserrat_20, LV_ALIGN_TOP_LEFT, 0, 0, headerTextColor, LV_TEXT_ALIGN_LEFT, LV_LABEL_LONG_WRAP, lv_pct(100));
-  lv_label_set_text_static(warningLabel, headerText);
+// Show the modal on top of the active screen
+void modalPool_open(PooledModal* pm) {
+  pm->used = true;
+  lv_obj_set_parent(pm->overlay, lv_scr_act());
+  lv_obj_clear_flag(pm->overlay, LV_OBJ_FLAG_HIDDEN);
+}
 
-  lv_obj_t* error = lv_label_create(modal);
-  lvc_label_init(error, &lv_font_montserrat_14, LV_ALIGN_CENTER, 0, 0, textColor, LV_TEXT_ALIGN_CENTER, LV_LABEL_LONG_WRAP, lv_pct(100));
-  lv_label_set_text_static(error, message);
+// Hide the modal and park it back on lv_layer_top(), so it survive the deletion of the screen
+void modalPool_close(PooledModal* pm) {
+  if (!pm->used)
+    return;
+  pm->used = false;
+  lv_obj_add_flag(pm->overlay, LV_OBJ_FLAG_HIDDEN);
+  lv_obj_set_parent(pm->overlay, lv_layer_top());
+}
 
-  lv_obj_t* okButton = lv_btn_create(modal);
-  lvc_btn_init(okButton, buttonText, LV_ALIGN_BOTTOM_RIGHT, -15, -15);
-  lv_obj_add_event_cb(okButton, [](lv_event_t* e) {lv_obj_del((lv_obj_t*)lv_event_get_user_data(e));}, LV_EVENT_CLICKED, overlay);
-  return modal;
+// Close every open pooled modal, must be called before loading a new screen since the old one is deleted
+void modalPool_closeAll() {
+  for (uint8_t i = 0; i < MODAL_POOL_ALERT_CNT; i++)
+    modalPool_close(&modalPool_alert[i]);
+  for (uint8_t i = 0; i < MODAL_POOL_ROLLPICK_CNT; i++)
+    modalPool_close(&modalPool_rollpick[i]);
+  modalPool_close(&modalPool_belManual);
 }
 
 bool rmvDir(const char* path) {
@@ -1257,6 +1620,9 @@ bool rmvDir(const char* path) {
   return ESPSYS_FS.rmdir(path);
 }
 bool belManual_load(BelManual* bm_target, size_t len) {
+  if (bm_target == belManual && settings.load(settingBelManual))
+    return true;
+  // Not stored on NVS yet, migrate from belManual.bin on SD
   if (!sdBeginFlag)
     return false;
   File file = ESPSYS_FS.open(PATH_ESPSYS"belManual.bin", "r");
@@ -1267,26 +1633,21 @@ bool belManual_load(BelManual* bm_target, size_t len) {
   }
   file.readBytes((char*)bm_target, sizeof(BelManual) * len);
   file.close();
+  if (bm_target == belManual)
+    settings.touch(settingBelManual);
   return true;
 }
 bool belManual_store(BelManual* bm_target, size_t len) {
-  if (!sdBeginFlag)
+  if (bm_target != belManual)
     return false;
-  File file = ESPSYS_FS.open(PATH_ESPSYS"belManual.bin", "w");
-  if (!file) {
-    file.close();
-    log_e("Error opening file!");
-    return false;
-  }
-  file.write((const uint8_t*)bm_target, sizeof(BelManual) * len);
-  file.close();
+  settings.touch(settingBelManual); // Written to NVS after the value settle
   return true;
 }
 bool jadwalHari_load(TemplateJadwal* tj_target, JadwalHari* jwh_target, int num) {
   if (!sdBeginFlag)
     return false;
   if (strlen(tj_target->name) == 0) {
-    log_e("tj_target->name mustn't empty!%s");
+    log_e("tj_target->name mustn't empty!");
     return false;
   }
   char tempPath[128];
@@ -1350,23 +1711,17 @@ bool templateJadwal_store(TemplateJadwal* tj_target) {
   return true;
 }
 bool templateJadwal_activeName_update(const char* activeName) {
-  if (!sdBeginFlag)
-    return false;
-  char temp[33];
-  strcpy(temp, activeName);
-  File file = ESPSYS_FS.open(PATH_ESPSYS"tj_active_name.bin", "w+");
-  log_d("updating tj_active_name.bin to %s", activeName);
-  if (!file) {
-    file.close();
-    log_e("Error opening file!");
-    return false;
-  }
-  file.write((const uint8_t*)temp, sizeof(TemplateJadwal::name));
-  file.close();
-  log_d("updating tj_active_name.bin OK\n");
+  log_d("updating tj_active_name to %s", activeName);
+  strncpy(tj_active_name, activeName, sizeof(tj_active_name) - 1);
+  settings.touch(settingTjActiveName); // Written to NVS after the value settle
   return true;
 }
 bool templateJadwal_activeName_load() {
+  if (settings.load(settingTjActiveName)) {
+    log_d("tj_active_name loaded : %s", tj_active_name);
+    return true;
+  }
+  // Not stored on NVS yet, migrate from tj_active_name.bin on SD
   if (!sdBeginFlag)
     return false;
   File file = ESPSYS_FS.open(PATH_ESPSYS"tj_active_name.bin", "r");
@@ -1378,50 +1733,139 @@ bool templateJadwal_activeName_load() {
   }
   file.readBytes((char*)tj_active_name, sizeof(TemplateJadwal::name));
   file.close();
+  settings.touch(settingTjActiveName);
   log_d("tj_active_name.bin loaded : %s", tj_active_name);
   return true;
 }
 bool templateJadwal_list_load() {
   if (!sdBeginFlag)
     return false;
-  int tjIndex = 0;
   bool tjUsedFound = false;
   log_d("Loading TemplateJadwal lists....");
-  File root = ESPSYS_FS.open(PATH_ESPSYS"tj");
-  if (!root) {
-    log_e("Error : Root doesn't exist!");
-    return false;
-  }
-  if (!root.isDirectory()) {
-    log_e("Error : Root is not directory!");
-    return false;
-  }
-  File file = root.openNextFile();
-  while (file)
-  {
-    if (!file.isDirectory()) {
-      templateJadwal_load(&tj_lists[tjIndex], file.path());
-      log_d("compare loaded %s to tj_active_name %s", tj_lists[tjIndex].name, tj_active_name);
-      if (strcmp(tj_lists[tjIndex].name, tj_active_name) == 0) {
-        templateJadwal_changeUsedTJ(tj_lists[tjIndex], false, false);
-        tjUsedFound = true;
-        log_d("tj_used name %s type %d", tj_used.name, tj_used.tipeJadwal);
-      }
-      tjIndex++;
+  // Read every template from the manifest with one open, instead of opening every .bin on PATH_TJ
+  TemplateJadwalManifest manifest = { 0 };
+  File file = ESPSYS_FS.open(PATH_ESPSYS"tj_manifest.bin", "r");
+  bool manifestValid = file && file.readBytes((char*)&manifest, sizeof(manifest)) == sizeof(manifest)
+    && manifest.magic == TJ_MANIFEST_MAGIC && manifest.version == TJ_MANIFEST_VERSION
+    && file.size() == sizeof(manifest) + manifest.count * sizeof(TemplateJadwal)
+    && templateJadwal_list_reserve(manifest.count)
+    && file.readBytes((char*)tj_lists, manifest.count * sizeof(TemplateJadwal)) == manifest.count * sizeof(TemplateJadwal);
+  file.close();
+  if (manifestValid)
+    tj_total_active = manifest.count;
+  else { // First boot after update or broken manifest, rebuild it from the .bin on PATH_TJ
+    log_d("tj_manifest.bin not valid, scanning " PATH_TJ);
+    int tjIndex = 0;
+    File root = ESPSYS_FS.open(PATH_ESPSYS"tj");
+    if (!root) {
+      log_e("Error : Root doesn't exist!");
+      return false;
+    }
+    if (!root.isDirectory()) {
+      log_e("Error : Root is not directory!");
+      return false;
     }
     file = root.openNextFile();
+    while (file)
+    {
+      if (!file.isDirectory() && templateJadwal_list_reserve(tjIndex + 1)) {
+        if (templateJadwal_load(&tj_lists[tjIndex], file.path()))
+          tjIndex++;
+      }
+      file = root.openNextFile();
+    }
+    file.close();
+    root.close();
+    tj_total_active = tjIndex;
+    templateJadwal_manifest_store();
+  }
+  for (int i = 0; i < tj_total_active; i++) {
+    log_d("compare loaded %s to tj_active_name %s", tj_lists[i].name, tj_active_name);
+    if (strcmp(tj_lists[i].name, tj_active_name) == 0) {
+      templateJadwal_changeUsedTJ(tj_lists[i], false, false);
+      tjUsedFound = true;
+      log_d("tj_used name %s type %d", tj_used.name, tj_used.tipeJadwal);
+      break;
+    }
   }
-  file.close();
-  root.close();
-  tj_total_active = tjIndex;
   if (!tjUsedFound) {
     log_d("Can't find active tj");
-    templateJadwal_changeUsedTJ(tj_lists[tjIndex - 1], false, false);
+    if (tj_total_active == 0) {
+      log_e("No TemplateJadwal available!");
+      return true;
+    }
+    templateJadwal_changeUsedTJ(tj_lists[tj_total_active - 1], false, false);
     log_d("tj_active set to %s %d", tj_used.name, tj_used.tipeJadwal);
     templateJadwal_activeName_update(tj_used.name);
   }
   return true;
 }
+bool templateJadwal_list_reserve(uint16_t count) {
+  if (count <= tj_lists_capacity)
+    return true;
+  uint16_t capacity = tj_lists_capacity == 0 ? 8 : tj_lists_capacity;
+  while (capacity < count)
+    capacity *= 2;
+  TemplateJadwal* lists = (TemplateJadwal*)realloc(tj_lists, sizeof(TemplateJadwal) * capacity);
+  if (lists == NULL) {
+    log_e("Can't allocate %d TemplateJadwal!", capacity);
+    return false;
+  }
+  tj_lists = lists;
+  tj_lists_capacity = capacity;
+  return true;
+}
+bool templateJadwal_manifest_store() {
+  if (!sdBeginFlag)
+    return false;
+  TemplateJadwalManifest manifest = { TJ_MANIFEST_MAGIC, TJ_MANIFEST_VERSION, tj_total_active };
+  // Write to temporary file first so a broken write doesn't replace a good manifest
+  File file = ESPSYS_FS.open(PATH_ESPSYS"tj_manifest.tmp", "w");
+  log_d("store tj_manifest.bin with %d TemplateJadwal", tj_total_active);
+  if (!file) {
+    file.close();
+    log_e("Error opening file!");
+    return false;
+  }
+  bool ok = file.write((const uint8_t*)&manifest, sizeof(manifest)) == sizeof(manifest)
+    && file.write((const uint8_t*)tj_lists, tj_total_active * sizeof(TemplateJadwal)) == tj_total_active * sizeof(TemplateJadwal);
+  file.close();
+  if (!ok) {
+    log_e("Error writing tj_manifest.tmp!");
+    return false;
+  }
+  ESPSYS_FS.remove(PATH_ESPSYS"tj_manifest.bin");
+  return ESPSYS_FS.rename(PATH_ESPSYS"tj_manifest.tmp", PATH_ESPSYS"tj_manifest.bin");
+}
+// Replace the manifest record named oldName (tj_target name when NULL) with tj_target, appended when not found
+// When tj_target is already a record of tj_lists the manifest is just rewritten
+bool templateJadwal_manifest_update(const char* oldName, TemplateJadwal* tj_target) {
+  if (tj_target < tj_lists || tj_target >= tj_lists + tj_total_active) {
+    TemplateJadwal updated = *tj_target; // tj_target might be moved by reserve
+    const char* name = oldName != NULL ? oldName : updated.name;
+    int i = 0;
+    for (; i < tj_total_active; i++)
+      if (strcmp(tj_lists[i].name, name) == 0)
+        break;
+    if (i == tj_total_active) {
+      if (!templateJadwal_list_reserve(tj_total_active + 1))
+        return false;
+      i = tj_total_active++;
+    }
+    tj_lists[i] = updated;
+  }
+  return templateJadwal_manifest_store();
+}
+bool templateJadwal_manifest_remove(const char* name) {
+  for (int i = 0; i < tj_total_active; i++) {
+    if (strcmp(tj_lists[i].name, name) == 0) {
+      memmove(tj_lists + i, tj_lists + i + 1, (tj_total_active - i - 1) * sizeof(TemplateJadwal));
+      tj_total_active--;
+      return templateJadwal_manifest_store();
+    }
+  }
+  return false;
+}
 bool templateJadwal_create(TemplateJadwal* tj_target) {
   if (!sdBeginFlag)
     return false;
@@ -1455,6 +1899,7 @@ bool templateJadwal_create(TemplateJadwal* tj_target) {
     file.write((uint8_t*)&jw_empty, sizeof(JadwalHari));
     file.close();
   }
+  templateJadwal_manifest_update(NULL, tj_target);
   log_d("OK\n\n");
   return true;
 }
@@ -1467,7 +1912,7 @@ bool templateJadwal_changeUsedTJ(TemplateJadwal to, bool refreshElements, bool u
     if (scrAct == mainMenu && mainMenu != mainScreen) { // Updates objects on screen 2
       lv_event_send(tab1_namaTj, LV_EVENT_REFRESH, NULL);
     }
-    tabelJadwalHariIni(); // Update tabelJadwalHariIni because template jadwal is changed
+    tabelJadwalHariIni(true); // Update tabelJadwalHariIni because template jadwal is changed
   }
   if (updateBinary)
     return templateJadwal_activeName_update(tj_used.name);
@@ -1491,25 +1936,203 @@ bool templateJadwal_delete(TemplateJadwal* tj_target) {
     return false;
   }
   log_d("OK\n");
+  char name[FS_MAX_NAME_LEN];
+  strcpy(name, tj_target->name); // tj_target might be a record of tj_lists
+  templateJadwal_manifest_remove(name);
   templateJadwal_list_load(); // Reload the lists after success delete
   return true;
 }
-bool volume_store() {
+// Create template jadwal from CSV/JSON file, the bells are written to staging folder and only moved into PATH_TJ when every row is valid
+bool templateJadwal_import(const char* path, char* message, size_t messageLen) {
+  if (!sdBeginFlag) {
+    snprintf(message, messageLen, "Kartu SD tidak terdeteksi!");
+    return false;
+  }
+  const char* ext = strrchr(path, '.');
+  bool json = ext && strcasecmp(ext, ".json") == 0;
+  File file = ESPSYS_FS.open(path, "r");
+  if (!file) {
+    snprintf(message, messageLen, "Gagal membuka %s", path);
+    return false;
+  }
+  log_d("import tj from %s", path);
+
+  // Template name is the file name without extension unless the JSON carries one
+  TemplateJadwal tj_import;
+  const char* baseName = strrchr(path, '/');
+  baseName = baseName ? baseName + 1 : path;
+  size_t nameLen = (ext && ext > baseName) ? ext - baseName : strlen(baseName);
+  if (nameLen >= FS_MAX_NAME_LEN)
+    nameLen = FS_MAX_NAME_LEN - 1;
+  strncpy(tj_import.name, baseName, nameLen);
+  tj_import.name[nameLen] = 0;
+
+  // First pass, validate every row and count the bells of each day
+  ScheduleRow row;
+  char lastAudio[SCHEDULE_AUDIO_LEN] = { 0 }; // Consecutive rows often share the audio file, check it only once
+  uint16_t everyDayCount = 0, dayCount[7] = { 0 };
+  bool hasDay = false;
+  ScheduleReader* reader = json ? (ScheduleReader*)new JsonScheduleReader(file) : new CsvScheduleReader(file);
+  bool valid = true;
+  while (valid && reader->next(row)) {
+    if (strcmp(row.audio, lastAudio) != 0) {
+      if (!is_filename_mp3(row.audio) || !ESPSYS_FS.exists(row.audio)) {
+        snprintf(message, messageLen, "Baris %lu : file audio %s tidak ditemukan", (unsigned long)reader->line(), row.audio);
+        valid = false;
+        break;
+      }
+      strcpy(lastAudio, row.audio);
+    }
+    if (row.hari == SCHEDULE_EVERY_DAY)
+      everyDayCount++;
+    else {
+      dayCount[row.hari]++;
+      hasDay = true;
+    }
+  }
+  if (valid && strlen(reader->error()) > 0) {
+    snprintf(message, messageLen, "%s", reader->error());
+    valid = false;
+  }
+  if (strlen(reader->templateName) > 0)
+    strcpy(tj_import.name, reader->templateName);
+  tj_import.tipeJadwal = reader->tipe != SCHEDULE_TIPE_UNKNOWN ? reader->tipe : hasDay ? TJ_MINGGUAN : TJ_HARIAN;
+  delete reader;
+
+  if (valid) {
+    uint16_t maxCount = 0, totalCount = everyDayCount;
+    for (int i = 0; i < 7; i++) {
+      totalCount += dayCount[i];
+      if (everyDayCount + dayCount[i] > maxCount)
+        maxCount = everyDayCount + dayCount[i];
+    }
+    if (tj_import.tipeJadwal == TJ_HARIAN)
+      maxCount = totalCount;
+    char tjPath[64];
+    sprintf(tjPath, PATH_TJ"%s.bin", tj_import.name);
+    valid = false;
+    if (totalCount == 0)
+      snprintf(message, messageLen, "Tidak ada bel pada %s", path);
+    else if (maxCount > MAX_BELL)
+      snprintf(message, messageLen, "Jumlah bel dalam satu hari lebih dari %d", MAX_BELL);
+    else if (strlen(tj_import.name) == 0 || strchr(tj_import.name, '/') != NULL)
+      snprintf(message, messageLen, "Nama template tidak valid");
+    else if (ESPSYS_FS.exists(tjPath))
+      snprintf(message, messageLen, "Template jadwal %s sudah ada", tj_import.name);
+    else
+      valid = true;
+  }
+  if (!valid) {
+    file.close();
+    log_e("import failed : %s", message);
+    return false;
+  }
+
+  // Second pass, one pass for each day so only one JadwalHari is kept on memory
+  if (ESPSYS_FS.exists(PATH_TJ_IMPORT))
+    rmvDir(PATH_TJ_IMPORT);
+  if (!ESPSYS_FS.mkdir(PATH_TJ_IMPORT)) {
+    file.close();
+    snprintf(message, messageLen, "Gagal membuat folder sementara");
+    return false;
+  }
+  JadwalHari* jw_import = new JadwalHari();
+  char dayPath[64];
+  for (int day = 0; day < 7 && valid; day++) {
+    *jw_import = jw_empty;
+    if (day == 0 || tj_import.tipeJadwal == TJ_MINGGUAN) { // Harian only uses the first day
+      file.seek(0);
+      reader = json ? (ScheduleReader*)new JsonScheduleReader(file) : new CsvScheduleReader(file);
+      while (reader->next(row)) {
+        if (tj_import.tipeJadwal == TJ_MINGGUAN && row.hari != SCHEDULE_EVERY_DAY && row.hari != day)
+          continue;
+        // Insert sorted by jadwalBel, next bell lookup on loop() relies on it
+        int pos = jw_import->jumlahBel;
+        for (; pos > 0 && jw_import->jadwalBel[pos - 1] > row.jadwal; pos--) {
+          jw_import->jadwalBel[pos] = jw_import->jadwalBel[pos - 1];
+          strcpy(jw_import->namaBel[pos], jw_import->namaBel[pos - 1]);
+          strcpy(jw_import->belAudioFile[pos], jw_import->belAudioFile[pos - 1]);
+        }
+        jw_import->jadwalBel[pos] = row.jadwal;
+        strcpy(jw_import->namaBel[pos], row.nama);
+        strcpy(jw_import->belAudioFile[pos], row.audio);
+        jw_import->jumlahBel++;
+      }
+      delete reader;
+    }
+    sprintf(dayPath, PATH_TJ_IMPORT"/%d", day);
+    File dayFile = ESPSYS_FS.open(dayPath, "w+");
+    valid = dayFile && dayFile.write((const uint8_t*)jw_import, sizeof(JadwalHari)) == sizeof(JadwalHari);
+    dayFile.close();
+  }
+  delete jw_import;
+  file.close();
+
+  // Commit, the template is only listed once its .bin is on PATH_TJ so it's moved last
+  char pathTo[64];
+  sprintf(pathTo, PATH_TJ"%s", tj_import.name);
+  if (valid) {
+    File tjFile = ESPSYS_FS.open(PATH_TJ_IMPORT".bin", "w+");
+    valid = tjFile && tjFile.write((const uint8_t*)&tj_import, sizeof(TemplateJadwal)) == sizeof(TemplateJadwal);
+    tjFile.close();
+  }
+  if (valid)
+    valid = ESPSYS_FS.rename(PATH_TJ_IMPORT, pathTo);
+  if (valid) {
+    strcat(pathTo, ".bin");
+    valid = ESPSYS_FS.rename(PATH_TJ_IMPORT".bin", pathTo);
+    if (!valid) { // Don't leave folder without .bin on PATH_TJ
+      sprintf(pathTo, PATH_TJ"%s", tj_import.name);
+      rmvDir(pathTo);
+    }
+  }
+  if (!valid) {
+    if (ESPSYS_FS.exists(PATH_TJ_IMPORT))
+      rmvDir(PATH_TJ_IMPORT);
+    ESPSYS_FS.remove(PATH_TJ_IMPORT".bin");
+    snprintf(message, messageLen, "Gagal menyimpan template jadwal %s", tj_import.name);
+    return false;
+  }
+  templateJadwal_manifest_update(NULL, &tj_import);
+  snprintf(message, messageLen, "Template jadwal %s berhasil diimport", tj_import.name);
+  log_d("import OK : %s", tj_import.name);
+  return true;
+}
+bool templateJadwal_export(TemplateJadwal* tj_target, const char* path, bool json) {
   if (!sdBeginFlag)
     return false;
-  File file = ESPSYS_FS.open(PATH_ESPSYS"volume.bin", "w+");
-  log_d("updating volume.bin");
+  File file = ESPSYS_FS.open(path, "w");
+  log_d("export tj %s to %s", tj_target->name, path);
   if (!file) {
     file.close();
     log_e("Error opening file!");
     return false;
   }
-  file.write((uint8_t*)&audioVolume, sizeof(audioVolume));
+  bool mingguan = tj_target->tipeJadwal == TJ_MINGGUAN;
+  ScheduleWriter writer(file, json);
+  writer.begin(tj_target->name, mingguan);
+  JadwalHari* jw_export = new JadwalHari();
+  bool ok = true;
+  for (int day = 0; day < (mingguan ? 7 : 1) && ok; day++) {
+    ok = jadwalHari_load(tj_target, jw_export, day);
+    for (int i = 0; ok && i < jw_export->jumlahBel; i++)
+      writer.row(mingguan ? day : SCHEDULE_EVERY_DAY, jw_export->jadwalBel[i], jw_export->namaBel[i], jw_export->belAudioFile[i]);
+  }
+  writer.end();
+  delete jw_export;
   file.close();
-  log_d("volume.bin updated");
+  return ok;
+}
+bool volume_store() {
+  settings.touch(settingVolume); // Written to NVS after the value settle
   return true;
 }
 bool volume_load() {
+  if (settings.load(settingVolume)) {
+    log_d("volume loaded : %d", audioVolume);
+    return true;
+  }
+  // Not stored on NVS yet, migrate from volume.bin on SD
   if (!sdBeginFlag)
     return false;
   File file = ESPSYS_FS.open(PATH_ESPSYS"volume.bin", "r");
@@ -1521,6 +2144,7 @@ bool volume_load() {
   }
   file.readBytes((char*)&audioVolume, sizeof(audioVolume));
   file.close();
+  settings.touch(settingVolume);
   log_d("volume.bin loaded : %d", audioVolume);
   return true;
 }
@@ -1541,9 +2165,9 @@ void macCheck() {
 void checkFirmwareBinary() {
   if (!sdBeginFlag)
     return;
-  if (!ESPSYS_FS.exists("/firmware.bin"))
+  if (!ESPSYS_FS.exists(PATH_FIRMWARE))
     return;
-  File updateBin = ESPSYS_FS.open("/firmware.bin");
+  File updateBin = ESPSYS_FS.open(PATH_FIRMWARE);
   if (updateBin) {
     if (updateBin.isDirectory()) {
       log_e("Error, firmware.bin is not a file");
@@ -1565,51 +2189,198 @@ void checkFirmwareBinary() {
   else
     log_e("Could not load firmware.bin");
 }
-void performFirmwareUpdate(Stream& updateSource, size_t updateSize) {
-  if (Update.begin(updateSize)) {
-    tft.fillScreen(TFT_BLACK);
-    tft.setTextSize(2);
-    tft.setTextColor(TFT_GREEN, TFT_BLACK);
-    tft.setCursor(0, 0);
-    tft.print("Updating Firmware...");
-    Update.onProgress(update_onProgress_callback);
-    size_t written = Update.writeStream(updateSource);
-    if (Update.end()) {
-      log_i("OTA done!");
-      if (Update.isFinished()) {
-        delay(1000);
-        log_i("Update successfully completed. Rebooting.");
-        tft.setCursor(0, 50);
-        tft.printf("Update successfully completed. Rebooting in 3s");
-        // we finished remove the binary from sd card to indicate end of the process
-        ESPSYS_FS.remove("/firmware.bin");
-        delay(3000);
-        ESP.restart();
-      }
-      else {
-        log_e("Update not finished? Something went wrong!");
-        tft.setCursor(0, 50);
-        tft.printf("Update not finished? Something went wrong!");
-      }
-    }
-    else {
-      log_e("Error Occurred. Error #: %s", Update.errorString());
-      tft.setCursor(0, 50);
-      tft.printf("Error Occurred. Error #: %s", Update.errorString());
-    }
+// Firmware is read from SD on a separate task while the previous chunk is written to flash,
+// the two buffers are passed back and forth through fwFreeQueue and fwFilledQueue
+struct FirmwareChunk {
+  uint8_t* data;
+  size_t len; // 0 mean read error
+};
+QueueHandle_t fwFreeQueue, fwFilledQueue;
+SemaphoreHandle_t fwReadDone;
+File* fwSource;
+size_t fwRemaining;
+volatile bool fwAbort;
+
+void firmwareReadTask_cb(void* pvParameters) {
+  FirmwareChunk chunk;
+  while (fwRemaining > 0 && !fwAbort) {
+    xQueueReceive(fwFreeQueue, &chunk, portMAX_DELAY);
+    if (fwAbort)
+      break;
+    chunk.len = fwSource->read(chunk.data, fwRemaining < FW_UPDATE_CHUNK_SIZE ? fwRemaining : FW_UPDATE_CHUNK_SIZE);
+    xQueueSend(fwFilledQueue, &chunk, portMAX_DELAY);
+    if (chunk.len == 0)
+      break;
+    fwRemaining -= chunk.len;
+  }
+  xSemaphoreGive(fwReadDone);
+  vTaskDelete(NULL);
+}
 
+// Read expected hash from PATH_FIRMWARE_SHA256, return -1 when the file doesn't exist, 0 when invalid, 1 when loaded
+int firmwareHash_load(uint8_t* hash) {
+  if (!ESPSYS_FS.exists(PATH_FIRMWARE_SHA256))
+    return -1;
+  File hashFile = ESPSYS_FS.open(PATH_FIRMWARE_SHA256);
+  if (!hashFile)
+    return 0;
+  char hex[64];
+  size_t len = 0;
+  while (hashFile.available() && len < sizeof(hex)) { // Accept sha256sum output, leading whitespace and trailing filename ignored
+    char c = hashFile.read();
+    if (len == 0 && isspace(c))
+      continue;
+    if (!isxdigit(c))
+      break;
+    hex[len++] = c;
   }
-  else
-  {
+  hashFile.close();
+  if (len != sizeof(hex))
+    return 0;
+  for (uint8_t i = 0; i < 32; i++) {
+    char byteHex[3] = { hex[i * 2], hex[i * 2 + 1], 0 };
+    hash[i] = strtoul(byteHex, NULL, 16);
+  }
+  return 1;
+}
+
+void performFirmwareUpdate(File& updateSource, size_t updateSize) {
+  tft.fillScreen(TFT_BLACK);
+  tft.setTextSize(2);
+  tft.setTextColor(TFT_GREEN, TFT_BLACK);
+  tft.setCursor(0, 0);
+  tft.print("Updating Firmware...");
+
+  uint8_t expectedHash[32], actualHash[32];
+  int hashStatus = firmwareHash_load(expectedHash);
+  if (hashStatus == 0) {
+    log_e("Invalid %s", PATH_FIRMWARE_SHA256);
+    tft.setCursor(0, 50);
+    tft.printf("Invalid %s, update cancelled", PATH_FIRMWARE_SHA256);
+    return;
+  }
+  if (hashStatus < 0) {
+#if FW_UPDATE_ALLOW_UNVERIFIED
+    log_w("%s not found, firmware won't be verified", PATH_FIRMWARE_SHA256);
+#else
+    log_e("%s not found, unverified firmware refused", PATH_FIRMWARE_SHA256);
+    tft.setCursor(0, 50);
+    tft.printf("%s not found, update cancelled", PATH_FIRMWARE_SHA256);
+    return;
+#endif
+  }
+
+  if (!Update.begin(updateSize)) {
     log_i("Not enough space to begin firmware update");
     tft.setCursor(0, 50);
     tft.printf("Not enough space to begin firmware update");
+    return;
   }
-}
 
-void update_onProgress_callback(size_t s, size_t s2) {
-  tft.setCursor(0, 50);
-  tft.printf("%lu/%lu", Update.progress(), Update.size());
+  FirmwareChunk chunks[2];
+  for (uint8_t i = 0; i < 2; i++) {
+    chunks[i].data = (uint8_t*)heap_caps_malloc(FW_UPDATE_CHUNK_SIZE, MALLOC_CAP_DMA);
+    chunks[i].len = 0;
+  }
+  if (!chunks[0].data || !chunks[1].data) {
+    log_e("Could not allocate firmware buffer");
+    tft.setCursor(0, 50);
+    tft.printf("Could not allocate firmware buffer");
+    heap_caps_free(chunks[0].data);
+    heap_caps_free(chunks[1].data);
+    Update.abort();
+    return;
+  }
+  fwFreeQueue = xQueueCreate(2, sizeof(FirmwareChunk));
+  fwFilledQueue = xQueueCreate(2, sizeof(FirmwareChunk));
+  fwReadDone = xSemaphoreCreateBinary();
+  xQueueSend(fwFreeQueue, &chunks[0], 0);
+  xQueueSend(fwFreeQueue, &chunks[1], 0);
+  fwSource = &updateSource;
+  fwRemaining = updateSize;
+  fwAbort = false;
+  xTaskCreatePinnedToCore(firmwareReadTask_cb, "fwReadTask", 4096, NULL, 2, NULL, 0);
+
+  mbedtls_sha256_context shaContext;
+  mbedtls_sha256_init(&shaContext);
+  mbedtls_sha256_starts_ret(&shaContext, 0);
+  size_t written = 0;
+  bool writeOk = true;
+  uint32_t progressMillis = millis(), startMillis = millis();
+  while (written < updateSize) {
+    FirmwareChunk chunk;
+    xQueueReceive(fwFilledQueue, &chunk, portMAX_DELAY);
+    if (chunk.len == 0) {
+      log_e("Error reading %s at %u", PATH_FIRMWARE, written);
+      writeOk = false;
+      break;
+    }
+    mbedtls_sha256_update_ret(&shaContext, chunk.data, chunk.len);
+    writeOk = Update.write(chunk.data, chunk.len) == chunk.len;
+    written += chunk.len;
+    xQueueSend(fwFreeQueue, &chunk, portMAX_DELAY); // Give the buffer back before anything else so reading continue
+    if (!writeOk)
+      break;
+    if (millis() - progressMillis >= FW_UPDATE_PROGRESS_PERIOD || written == updateSize) {
+      progressMillis = millis();
+      tft.setCursor(0, 50);
+      tft.printf("%3u%% %u/%u", (unsigned)((uint64_t)written * 100 / updateSize), (unsigned)written, (unsigned)updateSize);
+    }
+  }
+  fwAbort = true;
+  xQueueSend(fwFreeQueue, &chunks[0], 0); // Wake reader if it still wait for a buffer
+  xSemaphoreTake(fwReadDone, portMAX_DELAY);
+  mbedtls_sha256_finish_ret(&shaContext, actualHash);
+  mbedtls_sha256_free(&shaContext);
+  vQueueDelete(fwFreeQueue);
+  vQueueDelete(fwFilledQueue);
+  vSemaphoreDelete(fwReadDone);
+  heap_caps_free(chunks[0].data);
+  heap_caps_free(chunks[1].data);
+  log_i("Firmware written %u bytes in %lu ms", written, millis() - startMillis);
+
+  tft.setCursor(0, 75);
+  if (!writeOk) {
+    log_e("Error Occurred. Error #: %s", Update.errorString());
+    tft.printf("Error Occurred. Error #: %s", Update.errorString());
+    Update.abort();
+    return;
+  }
+  if (hashStatus > 0 && memcmp(expectedHash, actualHash, sizeof(actualHash)) != 0) {
+    log_e("Firmware SHA-256 mismatch");
+    tft.printf("SHA-256 mismatch, update cancelled");
+    Update.abort();
+    return;
+  }
+  char actualHex[65];
+  for (uint8_t i = 0; i < sizeof(actualHash); i++)
+    sprintf(actualHex + i * 2, "%02x", actualHash[i]);
+  log_i("Firmware SHA-256 %s %s", actualHex, hashStatus > 0 ? "verified" : "not verified");
+  if (Update.end()) {
+    log_i("OTA done!");
+    if (Update.isFinished()) {
+      delay(1000);
+      log_i("Update successfully completed. Rebooting.");
+      tft.printf("Update successfully completed. Rebooting in 3s");
+      // we finished remove the binary from sd card to indicate end of the process
+      updateSource.close();
+      ESPSYS_FS.remove(PATH_FIRMWARE);
+      ESPSYS_FS.remove(PATH_FIRMWARE_SHA256);
+      settings.flush(); // Don't lose pending settings on restart
+      bellLog.loop(ESPSYS_FS, PATH_BELL_LOG, true);
+      delay(3000);
+      Blog::flush();
+      ESP.restart();
+    }
+    else {
+      log_e("Update not finished? Something went wrong!");
+      tft.printf("Update not finished? Something went wrong!");
+    }
+  }
+  else {
+    log_e("Error Occurred. Error #: %s", Update.errorString());
+    tft.printf("Error Occurred. Error #: %s", Update.errorString());
+  }
 }
 
 // Traverser functions declaration
@@ -1618,6 +2389,7 @@ void Traverser::createTraverser(lv_obj_t* issuer, const char* dir, bool build) {
   traverserIssuer = issuer; // Save the issuer object pointer
   if (build) { // Build can't set to false when called first on issuer
     exist = true;
+    lvgl_mem_scope_begin(lvMemScopes[LVMEM_TRAVERSER]);
     overlay = lvc_create_overlay();
 
     modal = lv_obj_create(overlay);
@@ -1662,24 +2434,32 @@ void Traverser::createTraverser(lv_obj_t* issuer, const char* dir, bool build) {
   else
     lv_obj_add_state(traverseBackButton, LV_STATE_DISABLED);
 
-  // Calculate total file and folder within path
-  int rowLen = 0;
-
+  // Calculate total file and folder within path, only the count and where each page start are kept so memory
+  // doesn't grow with folder size. getNextFileName() doesn't open the entries like openNextFile()
+  entryCount = 0;
+  uint16_t position = 0;
+  bool isDir;
   File root = SD.open(traverseDirBuffer);
-  File file = root.openNextFile();
-  while (file)
-  {
-    if (strcmp(file.name(), "System Volume Information") != 0 && strcmp(file.name(), "espsys") != 0) {
-      if (!file.isDirectory() && !is_filename_mp3(file.name())) {
-        file = root.openNextFile();
-        continue;
+  for (String path = root.getNextFileName(&isDir); path.length() > 0; path = root.getNextFileName(&isDir), position++) {
+    const char* name = strrchr(path.c_str(), '/') ? strrchr(path.c_str(), '/') + 1 : path.c_str();
+    if (!isListed(name, isDir))
+      continue;
+    uint16_t page = entryCount / TRAVERSER_PAGE_ROWS;
+    if (entryCount % TRAVERSER_PAGE_ROWS == 0 && page >= pageStartCapacity) {
+      uint16_t capacity = pageStartCapacity == 0 ? 8 : pageStartCapacity * 2;
+      uint16_t* starts = (uint16_t*)realloc(pageStart, sizeof(uint16_t) * capacity);
+      if (starts == NULL) {
+        log_e("Can't allocate %d page positions, listing cut at %d entries", capacity, entryCount);
+        break;
       }
-      rowLen++;
+      pageStart = starts;
+      pageStartCapacity = capacity;
     }
-    file = root.openNextFile();
+    if (entryCount % TRAVERSER_PAGE_ROWS == 0)
+      pageStart[page] = position;
+    entryCount++;
   }
   root.close();
-  file.close();
 
   lv_obj_set_size(traverseBox, lv_pct(100), LV_SIZE_CONTENT);
   lv_obj_set_style_pad_all(traverseBox, 0, 0);
@@ -1688,57 +2468,120 @@ void Traverser::createTraverser(lv_obj_t* issuer, const char* dir, bool build) {
   lv_obj_set_scrollbar_mode(traverseBox, LV_SCROLLBAR_MODE_OFF);
   lv_obj_clear_flag(traverseBox, LV_OBJ_FLAG_SCROLLABLE);
 
-  lv_obj_t* table = lv_table_create(traverseBox); // Uses table to save memory
-  lv_obj_set_style_pad_all(table, 0, LV_PART_MAIN);
-  lv_obj_add_style(table, &style_noBorder, LV_PART_MAIN);
-  // Set the column and row beforehand to avoid memory reallocation later on
-  lv_table_set_col_cnt(table, 4);
-  lv_table_set_row_cnt(table, rowLen + 1);
+  traverseTable = lv_table_create(traverseBox); // Uses table to save memory
+  lv_obj_set_style_pad_all(traverseTable, 0, LV_PART_MAIN);
+  lv_obj_add_style(traverseTable, &style_noBorder, LV_PART_MAIN);
+  // Set the column and maximum row beforehand, row count never exceed one page so the table memory is constant
+  lv_table_set_col_cnt(traverseTable, 4);
+  lv_table_set_row_cnt(traverseTable, TRAVERSER_PAGE_ROWS + 1);
 
-  lv_obj_set_style_pad_top(table, 8, LV_PART_ITEMS);
-  lv_obj_set_style_pad_bottom(table, 8, LV_PART_ITEMS);
-  lv_obj_set_style_pad_right(table, 0, LV_PART_ITEMS);
-  lv_obj_set_style_pad_left(table, 0, LV_PART_ITEMS);
+  lv_obj_set_style_pad_top(traverseTable, 8, LV_PART_ITEMS);
+  lv_obj_set_style_pad_bottom(traverseTable, 8, LV_PART_ITEMS);
+  lv_obj_set_style_pad_right(traverseTable, 0, LV_PART_ITEMS);
+  lv_obj_set_style_pad_left(traverseTable, 0, LV_PART_ITEMS);
 
-  lv_obj_set_style_text_align(table, LV_TEXT_ALIGN_CENTER, LV_PART_ITEMS | LV_STATE_DEFAULT);
+  lv_obj_set_style_text_align(traverseTable, LV_TEXT_ALIGN_CENTER, LV_PART_ITEMS | LV_STATE_DEFAULT);
 
   for (int i = 0;i < 4;i++) {
-    lv_table_set_cell_value(table, 0, i, traverserTableHeader[i]);
-    lv_table_set_col_width(table, i, traverserCol_widthDescriptor[i]);
+    lv_table_set_cell_value(traverseTable, 0, i, traverserTableHeader[i]);
+    lv_table_set_col_width(traverseTable, i, traverserCol_widthDescriptor[i]);
   }
 
-  rowLen = 0;
+  // Page navigation below the table
+  pager = lv_obj_create(traverseBox);
+  lv_obj_set_size(pager, lv_pct(100), 50);
+  lv_obj_add_style(pager, &style_noBorder, 0);
+  lv_obj_set_style_bg_opa(pager, 0, 0);
+  lv_obj_set_scrollbar_mode(pager, LV_SCROLLBAR_MODE_OFF);
+  lv_obj_clear_flag(pager, LV_OBJ_FLAG_SCROLLABLE);
 
-  root = SD.open(traverseDirBuffer);
-  file = root.openNextFile();
-  while (file)
+  pagePrevButton = lv_btn_create(pager);
+  lvc_btn_init(pagePrevButton, LV_SYMBOL_LEFT, LV_ALIGN_LEFT_MID, 15, 0, &lv_font_montserrat_12);
+  lv_obj_add_event_cb(pagePrevButton, pageButtonClicked, LV_EVENT_CLICKED, (void*)-1);
+
+  pageLabel = lv_label_create(pager);
+  lvc_label_init(pageLabel, &lv_font_montserrat_14, LV_ALIGN_CENTER);
+
+  pageNextButton = lv_btn_create(pager);
+  lvc_btn_init(pageNextButton, LV_SYMBOL_RIGHT, LV_ALIGN_RIGHT_MID, -15, 0, &lv_font_montserrat_12);
+  lv_obj_add_event_cb(pageNextButton, pageButtonClicked, LV_EVENT_CLICKED, (void*)1);
+
+  loadPage(0);
+
+  lv_obj_add_event_cb(traverseTable, traverserTableDrawEventCallback, LV_EVENT_DRAW_PART_END, NULL); // Callback used to draw the pseudo button on the table (table can't draw object)
+  lv_obj_add_event_cb(traverseTable, traverserActionButtonClicked, LV_EVENT_VALUE_CHANGED, NULL); // Callback for traverseActionButton click
+  lvgl_mem_scope_end(lvMemScopes[LVMEM_TRAVERSER], overlay); // Rebuilt traverseBox is measured from the first build
+}
+bool Traverser::isListed(const char* name, bool isDir) {
+  if (strcmp(name, "System Volume Information") == 0 || strcmp(name, "espsys") == 0)
+    return false;
+  return isDir || is_filename_mp3(name);
+}
+void Traverser::loadPage(uint16_t page) {
+  uint16_t pageCount = entryCount == 0 ? 1 : (entryCount + TRAVERSER_PAGE_ROWS - 1) / TRAVERSER_PAGE_ROWS;
+  if (page >= pageCount)
+    page = pageCount - 1;
+  pageIdx = page;
+
+  uint16_t firstEntry = page * TRAVERSER_PAGE_ROWS;
+  uint16_t pageRows = entryCount - firstEntry < TRAVERSER_PAGE_ROWS ? entryCount - firstEntry : TRAVERSER_PAGE_ROWS;
+  lv_table_set_row_cnt(traverseTable, pageRows + 1);
+
+  // Start from the page position recorded when counting, only the entries of this page are opened
+  uint16_t row = 0;
+  File root = SD.open(traverseDirBuffer);
+  if (pageRows > 0)
+    root.seekDir(pageStart[page]);
+  File file = root.openNextFile();
+  while (file && row < pageRows)
   {
-    if (strcmp(file.name(), "System Volume Information") != 0 && strcmp(file.name(), "espsys") != 0) {
-      if (!file.isDirectory() && !is_filename_mp3(file.name())) {
-        file = root.openNextFile();
-        continue;
-      }
-      rowLen++;
+    if (isListed(file.name(), file.isDirectory())) {
+      row++;
       bool isDir = file.isDirectory();
       unsigned long size = (unsigned long)file.size();
-      lv_table_set_cell_value_fmt(table, rowLen, 0, "%d", rowLen);
-      lv_table_set_cell_value_fmt(table, rowLen, 1, (isDir) ? LV_SYMBOL_DIRECTORY " %s" : LV_SYMBOL_FILE " %s", file.name());
+      lv_table_set_cell_value_fmt(traverseTable, row, 0, "%d", firstEntry + row);
+      lv_table_set_cell_value_fmt(traverseTable, row, 1, (isDir) ? LV_SYMBOL_DIRECTORY " %s" : LV_SYMBOL_FILE " %s", file.name());
       if (isDir)
-        lv_table_set_cell_value_fmt(table, rowLen, 2, " ");
+        lv_table_set_cell_value_fmt(traverseTable, row, 2, " ");
       else {
         char sizestr[16] = { 0 };
         sprintf(sizestr, "%.1f %s", size < 1024 ? float(size) : size < 1048576 ? float(size) / 1024. : float(size) / 1048576., size < 1024 ? "B" : size < 1048576 ? "KB" : "MB");
-        lv_table_set_cell_value_fmt(table, rowLen, 2, sizestr); // Somehow the table build-in format can't take float, so we buffer it with another string
+        lv_table_set_cell_value_fmt(traverseTable, row, 2, sizestr); // Somehow the table build-in format can't take float, so we buffer it with another string
       }
-      lv_table_set_cell_value(table, rowLen, 3, "");
+      lv_table_set_cell_value(traverseTable, row, 3, "");
     }
     file = root.openNextFile();
   }
   root.close();
   file.close();
+  if (row < pageRows) // Directory changed between counting and listing, shrink the table to what was actually read
+    lv_table_set_row_cnt(traverseTable, row + 1);
 
-  lv_obj_add_event_cb(table, traverserTableDrawEventCallback, LV_EVENT_DRAW_PART_END, NULL); // Callback used to draw the pseudo button on the table (table can't draw object)
-  lv_obj_add_event_cb(table, traverserActionButtonClicked, LV_EVENT_VALUE_CHANGED, NULL); // Callback for traverseActionButton click
+  lv_label_set_text_fmt(pageLabel, "Halaman %d/%d", pageIdx + 1, pageCount);
+  if (pageIdx > 0)
+    lv_obj_clear_state(pagePrevButton, LV_STATE_DISABLED);
+  else
+    lv_obj_add_state(pagePrevButton, LV_STATE_DISABLED);
+  if (pageIdx < pageCount - 1)
+    lv_obj_clear_state(pageNextButton, LV_STATE_DISABLED);
+  else
+    lv_obj_add_state(pageNextButton, LV_STATE_DISABLED);
+  if (pageCount > 1)
+    lv_obj_clear_flag(pager, LV_OBJ_FLAG_HIDDEN);
+  else
+    lv_obj_add_flag(pager, LV_OBJ_FLAG_HIDDEN);
+
+  lv_obj_update_layout(traverseTable);
+  lv_obj_align_to(pager, traverseTable, LV_ALIGN_OUT_BOTTOM_MID, 0, 0);
+  lv_obj_scroll_to_y(modal, 0, LV_ANIM_OFF); // Start the new page from the top
+}
+void Traverser::pageButtonClicked(lv_event_t* e) {
+  if (!exist)
+    return;
+  int offset = (int)(intptr_t)lv_event_get_user_data(e);
+  if (offset < 0 && pageIdx == 0)
+    return;
+  loadPage(pageIdx + offset);
 }
 void Traverser::traverseBack(lv_event_t* event) {
   if (!exist)
@@ -1845,6 +2688,7 @@ void TemplateJadwalBuilder::create(int row) {
 
   log_d("loaded %s %d/%s", tj_target->name, tj_target->tipeJadwal, tj_target->tipeJadwal == TJ_MINGGUAN ? "Mingguan" : "Harian");
 
+  lvgl_mem_scope_begin(lvMemScopes[LVMEM_BUILDER]);
   btj_overlay = lvc_create_overlay();
 
   lv_obj_remove_event_cb(regularKeyboard, kb_event_cb);
@@ -1899,6 +2743,8 @@ void TemplateJadwalBuilder::create(int row) {
       modal_create_alert("Tidak ada perubahan dalam template jadwal!", "Peringatan!");
       return;
     }
+    char manifestName[FS_MAX_NAME_LEN]; // Name of the manifest record before rename
+    strcpy(manifestName, tj_oldName);
     if (strcmp(tj_oldName, tj_target->name) != 0) { // TemplateJadwal is renamed, so rename the binary and folder for the specified TemplateJadwal
       bool updateUsedTJ = strcmp(tj_oldName, tj_used.name) == 0;
       char pathFrom[64] = { 0 };
@@ -1926,7 +2772,7 @@ void TemplateJadwalBuilder::create(int row) {
       }
       strcpy(tj_oldName, tj_target->name);
     }
-    changed = !templateJadwal_store(tj_target);
+    changed = !templateJadwal_store(tj_target) || !templateJadwal_manifest_update(manifestName, tj_target);
     if (changed)
       modal_create_alert("Gagal menyimpan template jadwal!", "Gagal!", &lv_font_montserrat_20, &lv_font_montserrat_14, bs_white, bs_dark, bs_danger);
     else {
@@ -1935,7 +2781,7 @@ void TemplateJadwalBuilder::create(int row) {
       char tempName[FS_MAX_NAME_LEN] = { 0 };
       strcpy(tempName, tj_target->name);
       templateJadwal_list_load(); // Reload the tj_list because one of TemplateJadwal is changed
-      for (int i = 0; i < TJ_MAX_LEN;i++) { // Make sure the pointer for tj_target is still pointing to the edited TemplateJadwal
+      for (int i = 0; i < tj_total_active;i++) { // Make sure the pointer for tj_target is still pointing to the edited TemplateJadwal
         if (strcmp(tj_lists[i].name, tempName) == 0) {
           tj_target = &tj_lists[i];
           break;
@@ -1943,7 +2789,8 @@ void TemplateJadwalBuilder::create(int row) {
       }
 
       tj_table_build(); // Reload the template jadwal list on tab two
-      tabelJadwalHariIni(); // Update tabelJadwalHariIni on tab one just in case the tabel bel is changed
+      if (strcmp(tj_target->name, tj_used.name) == 0) // Update tabelJadwalHariIni on tab one just in case the tabel bel is changed
+        tabelJadwalHariIni(true);
     }
     log_d("Done Saving TJ");
     }, LV_EVENT_CLICKED, NULL);
@@ -1987,7 +2834,8 @@ void TemplateJadwalBuilder::create(int row) {
     lv_obj_t* btnLabel = (lv_obj_t*)lv_event_get_user_data(e);
     btj_wpd.issuer = btn;
     lv_obj_t* rollpick = rollpick_create(&btj_wpd, "Tipe Jadwal", tipeOptions, &lv_font_montserrat_20);
-    lv_roller_set_selected(rollpick, strcmp(lv_label_get_text(btnLabel), "Mingguan") == 0, LV_ANIM_OFF);
+    if (rollpick)
+      lv_roller_set_selected(rollpick, strcmp(lv_label_get_text(btnLabel), "Mingguan") == 0, LV_ANIM_OFF);
     }, LV_EVENT_CLICKED, btnLabel);
   lv_obj_add_event_cb(btj_modal_tjTypeBtn, [](lv_event_t* e) {
     changed = true;
@@ -2021,7 +2869,8 @@ void TemplateJadwalBuilder::create(int row) {
     if (belChanged == false) {
       btj_wpd.issuer = btj_modal_tjHariBtn;
       lv_obj_t* rollpick = rollpick_create(&btj_wpd, "Pilih Hari", hariOptions, &lv_font_montserrat_20);
-      lv_roller_set_selected(rollpick, strToDow(lv_label_get_text(btnLabel)), LV_ANIM_OFF);
+      if (rollpick)
+        lv_roller_set_selected(rollpick, strToDow(lv_label_get_text(btnLabel)), LV_ANIM_OFF);
       return;
     }
     else {
@@ -2033,7 +2882,8 @@ void TemplateJadwalBuilder::create(int row) {
     lv_obj_t* btnLabel = (lv_obj_t*)lv_event_get_user_data(e);
     btj_wpd.issuer = btj_modal_tjHariBtn;
     lv_obj_t* rollpick = rollpick_create(&btj_wpd, "Pilih Hari", hariOptions, &lv_font_montserrat_20);
-    lv_roller_set_selected(rollpick, strToDow(lv_label_get_text(btnLabel)), LV_ANIM_OFF);
+    if (rollpick)
+      lv_roller_set_selected(rollpick, strToDow(lv_label_get_text(btnLabel)), LV_ANIM_OFF);
     }, LV_EVENT_REFRESH, btnLabel);
   lv_obj_add_event_cb(btj_modal_tjHariBtn, [](lv_event_t* e) {
     lv_obj_t* btn = lv_event_get_target(e);
@@ -2068,7 +2918,8 @@ void TemplateJadwalBuilder::create(int row) {
     else
       modal_create_alert("Sukses menyimpan tabel bel!", "Sukses", &lv_font_montserrat_20, &lv_font_montserrat_14, bs_white, bs_dark, bs_success);
 
-    tabelJadwalHariIni(); // Update tabelJadwalHariIni just in case the changed tabel bel is used for tabelJadwalHariIni
+    if (strcmp(tj_target->name, tj_used.name) == 0) // Update tabelJadwalHariIni just in case the changed tabel bel is used for tabelJadwalHariIni
+      tabelJadwalHariIni(true);
     }, LV_EVENT_CLICKED, btnLabel);
 
   jadwalHari_load(tj_target, jw_temp, 0);
@@ -2164,6 +3015,7 @@ void TemplateJadwalBuilder::btj_tj_build(bool refresh) {
     lv_obj_update_layout(btj_modal_addBellBtn);
     lv_obj_update_layout(btj_dummyHeight);
     }, LV_EVENT_REFRESH, NULL); // Callback for action button click
+  lvgl_mem_scope_end(lvMemScopes[LVMEM_BUILDER], btj_overlay);
 }
 void TemplateJadwalBuilder::create_textarea_prompt(const char* placeholder) {
   lv_obj_t* overlay = lvc_create_overlay();
@@ -2316,8 +3168,33 @@ void TemplateJadwalBuilder::initComponentLabel(lv_obj_t* label, lv_obj_t* alignT
   lv_label_set_text_static(label, labelMessage);
 }
 
-lv_obj_t* lvc_create_overlay() {
-  lv_obj_t* overlay = lv_obj_create(lv_scr_act());
+// Set the cell only when its text differ, unchanged cells keep their allocation and aren't redrawn
+bool lvc_table_set_cell(lv_obj_t* table, uint16_t row, uint16_t col, const char* txt) {
+  if (strcmp(lv_table_get_cell_value(table, row, col), txt) == 0)
+    return false;
+  lv_table_set_cell_value(table, row, col, txt);
+  return true;
+}
+
+// Show or remove the message merged over the first data row, used when a table has no data row
+void lvc_table_set_empty_row(lv_obj_t* table, bool empty, const char* message) {
+  uint16_t colCnt = lv_table_get_col_cnt(table);
+  if (empty) {
+    lvc_table_set_cell(table, 1, 0, message);
+    for (uint16_t col = 1; col < colCnt; col++)
+      lvc_table_set_cell(table, 1, col, "");
+    for (uint16_t col = 0; col < colCnt - 1 && col < 3; col++)
+      lv_table_add_cell_ctrl(table, 1, col, LV_TABLE_CELL_CTRL_MERGE_RIGHT);
+  }
+  else if (lv_table_has_cell_ctrl(table, 1, 0, LV_TABLE_CELL_CTRL_MERGE_RIGHT)) {
+    for (uint16_t col = 0; col < colCnt - 1; col++)
+      lv_table_clear_cell_ctrl(table, 1, col, LV_TABLE_CELL_CTRL_MERGE_RIGHT);
+    lv_obj_invalidate(table);
+  }
+}
+
+lv_obj_t* lvc_create_overlay(lv_obj_t* parent) {
+  lv_obj_t* overlay = lv_obj_create(parent ? parent : lv_scr_act());
   lv_obj_set_size(overlay, 480, 320);
   lv_obj_add_style(overlay, &style_noBorder, 0);
   lv_obj_add_style(overlay, &style_zeroRadius, 0);
@@ -2434,3 +3311,95 @@ uint8_t strToDow(const char* str) {
     (strcmp(str, "Kamis") == 0) ? 4 :
     (strcmp(str, "Jumat") == 0) ? 5 : 6;
 }
+
+// Open every screen and dialog in turn and print build time, full redraw time, flushed bytes and
+// LVGL heap for each. Called from loop(), the LVGL lock is only held while building and redrawing
+void ui_benchmark() {
+  Serial.println("UI benchmark : step, build, full redraw, flushed, LVGL heap used (change), LVGL heap peak");
+
+  ui_benchmark_step("mainScreen", []() { loadMainScreen(); });
+  ui_benchmark_step("mainMenu tab1", []() { loadMainMenu(); });
+  ui_benchmark_step("mainMenu tab2", []() { lv_tabview_set_act(tabv, 1, LV_ANIM_OFF); });
+  ui_benchmark_step("mainMenu tab3", []() { lv_tabview_set_act(tabv, 2, LV_ANIM_OFF); });
+  ui_benchmark_step("alert", []() {
+    lv_tabview_set_act(tabv, 0, LV_ANIM_OFF);
+    modal_create_alert("Benchmark", "Peringatan!", &lv_font_montserrat_20, &lv_font_montserrat_14, bs_white, bs_dark, bs_danger);
+    });
+  ui_benchmark_step("confirm", []() {
+    static WidgetParameterData confirmWpd; // Never confirmed, the dialog is closed by ui_benchmark_close()
+    confirmWpd.issuer = lv_scr_act();
+    modal_create_confirm(&confirmWpd, "Benchmark", "Konfirmasi", &lv_font_montserrat_16, &lv_font_montserrat_14, bs_white, bs_dark, bs_warning);
+    });
+  ui_benchmark_step("rollpick", []() {
+    static uint16_t selected;
+    static WidgetParameterData rollpickWpd;
+    rollpickWpd.issuer = lv_scr_act();
+    rollpickWpd.param = &selected;
+    rollpick_create(&rollpickWpd, "Pilih Hari", TemplateJadwalBuilder::hariOptions);
+    });
+  ui_benchmark_step("bel manual", []() { belManual_btn_cb(NULL); });
+  if (sdBeginFlag) {
+    ui_benchmark_step("traverser", []() { Traverser::createTraverser(lv_scr_act(), "/"); });
+    if (tj_total_active > 0)
+      ui_benchmark_step("builder", []() { TemplateJadwalBuilder::create(1); });
+  }
+  else
+    Serial.println("No SD card, traverser and builder skipped");
+
+  lvgl_lock();
+  ui_benchmark_close();
+  loadMainScreen();
+  lvgl_unlock();
+}
+
+void ui_benchmark_step(const char* name, void (*build)()) {
+  lvgl_lock();
+  ui_benchmark_close(); // Previous step dialog
+  uint32_t heapBefore = lvgl_mem_used();
+  uint32_t start = micros();
+  build();
+  uint32_t buildUs = micros() - start;
+  lvgl_unlock();
+  delay(UI_BENCHMARK_SETTLE); // Let screen load animation finish and the deleted screen go
+
+  lvgl_lock();
+  uint32_t flushBytes = lvglFlushBytes;
+  uint32_t redrawUs = lvgl_measure_redraw();
+  flushBytes = lvglFlushBytes - flushBytes;
+  uint32_t heapUsed = lvgl_mem_used();
+  lvgl_unlock();
+  Serial.printf("%-14s %7lu us %7lu us %7lu B %6lu B (%+ld) %6lu B\n", name, buildUs, redrawUs, flushBytes, heapUsed,
+    (int32_t)(heapUsed - heapBefore), lvglMemPeak);
+}
+
+// Close whatever dialog a previous benchmark step opened, without sending its result to the issuer
+void ui_benchmark_close() {
+  modalPool_closeAll();
+  if (Traverser::exist) {
+    Traverser::exist = false;
+    lv_obj_del(Traverser::overlay);
+  }
+  if (lvMemScopes[LVMEM_BUILDER].open)
+    lv_obj_del(TemplateJadwalBuilder::btj_overlay);
+}
+
+// "audio", "render", "log", "i2c", "bellog" and "power" counter records of the serial console, values are read without lock so a record may
+// mix values from two consecutive updates
+void console_counters() {
+  sys_stats_printf("audio plays=%lu fails=%lu stops=%lu preempts=%lu playing=%d\n", audioPlayCount, audioFailCount,
+    audioStopCount, audioPreemptCount, isAudioPlaying);
+  sys_stats_printf("render frames=%lu flush_bytes=%lu last_refr_us=%lu\n", renderFrameCount, lvglFlushBytes,
+    renderStats[(renderStatsHead + RENDER_STATS_LEN - 1) % RENDER_STATS_LEN].refrUs);
+  sys_stats_printf("log written=%lu dropped=%lu pending=%u\n", Blog::written, Blog::dropped, Blog::pending());
+  sys_stats_printf("i2c transactions=%lu expander_writes=%lu expander_avoided=%lu rtc_reads=%lu queue_full=%lu\n",
+    i2cBus.transactions, ioExpander->transactions, ioExpander->avoided, i2cBus.rtcReads, i2cBus.queueFull);
+  sys_stats_printf("bellog written=%lu dropped=%lu write_errors=%lu\n", bellLog.written, bellLog.dropped, bellLog.writeErrors);
+  console_power();
+}
+
+void console_power() {
+  sys_stats_printf("power state=%u active_ms=%lu idle_ms=%lu sleep_ms=%lu sleeps=%lu wake_timer=%lu wake_touch=%lu wake_uart=%lu worst_wake_late_us=%ld cpu_mhz=%lu\n",
+    powerManager.current(), powerManager.timeIn(PM_ACTIVE), powerManager.timeIn(PM_IDLE), powerManager.timeIn(PM_SLEEP),
+    powerManager.sleeps, powerManager.wakeTimer, powerManager.wakeTouch, powerManager.wakeUart, powerManager.worstWakeLateUs,
+    getCpuFrequencyMhz());
+}
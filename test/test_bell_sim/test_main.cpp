@@ -0,0 +1,263 @@
+#include <unity.h>
+#include <vector>
+#include <bell_scheduler.h>
+
+// Bell simulator : the BellScheduler of the device replayed on a virtual clock, with the audio task replaced by a
+// fixed SIM_AUDIO_LENGTH. Time jumps minute to minute while nothing is pending and steps by SIM_TICK while the
+// relay or audio is active. Every bell is compared against the jadwal, and the relay and audio timing against
+// BELL_AUDIO_DELAY. Set BELL_SIM_CSV to a file name, or "-" for stdout, to get every event line as CSV
+
+#define SIM_TICK 10 // SCHEDULER_PERIOD (ms)
+#define SIM_AUDIO_LENGTH 10000 // ms
+#define SIM_SWITCH_DAYS 3 // Switch to the other template at 12:00 every this many days
+#define SIM_MAX_BELL 8
+#define SIM_YEAR_SIGNATURE 0x9A856240 // FNV-1a of the 2026 event lines, change only with the bell timing
+#define SIM_YEAR_EVENTS 7662
+
+// Virtual time, in ms since simEpoch (unix time)
+static uint64_t simMillis;
+static uint32_t simEpoch;
+static uint32_t simClock() { return (uint32_t)simMillis; }
+static FILE* simCsv = NULL; // Event lines output, from BELL_SIM_CSV
+
+// Same layout as JadwalHari
+struct Jadwal
+{
+    char namaBel[SIM_MAX_BELL][32];
+    uint32_t jadwalBel[SIM_MAX_BELL];
+    char belAudioFile[SIM_MAX_BELL][128];
+    uint8_t jumlahBel;
+};
+
+struct Template
+{
+    const char* name;
+    bool weekly; // Bells of day dayOfTheWeek(), otherwise every day use day 0
+    std::vector<uint16_t> days[7];
+};
+
+static const Template templates[2] = {
+    { "Reguler", true, { { 2359 }, { 700, 930, 1200, 1400 }, { 700, 930, 1200, 1400 }, { 700, 930, 1200, 1400 },
+        { 700, 930, 1200, 1400 }, { 700, 930, 1200, 1400 }, { 700, 1100 } } },
+    { "Ujian", false, { { 0, 800, 1000, 1200, 2359 } } },
+};
+
+static void loadJadwal(const Template& tj, Jadwal& jw, uint8_t dayOfTheWeek)
+{
+    const std::vector<uint16_t>& bells = tj.days[tj.weekly ? dayOfTheWeek : 0];
+    jw.jumlahBel = bells.size();
+    for (uint8_t i = 0; i < jw.jumlahBel; i++) {
+        jw.jadwalBel[i] = bells[i];
+        snprintf(jw.namaBel[i], sizeof(jw.namaBel[i]), "%s %04u", tj.name, bells[i]);
+        snprintf(jw.belAudioFile[i], sizeof(jw.belAudioFile[i]), "/bel/%s_%u.mp3", tj.name, i);
+    }
+}
+
+// Bell output of the simulator, audio plays for a fixed length and every event is timed, hashed and written to csv
+class SimBellOutput : public BellOutput
+{
+    bool playing = false, stopped = false, relayOn = false;
+    uint64_t audioEnd = 0;
+    uint32_t hash = 2166136261u; // FNV-1a of every event line
+
+public:
+    std::vector<uint64_t> relayOnAt, relayOffAt, audioAt, audioEndAt; // simMillis
+    uint32_t events = 0;
+    FILE* csv = simCsv;
+
+    // "YYYY-MM-DD hh:mm:ss.mmm,what,detail"
+    void event(const char* what, const char* detail = "")
+    {
+        char line[BELL_FILE_LEN + 64];
+        DateTime t(simEpoch + (uint32_t)(simMillis / 1000));
+        int len = snprintf(line, sizeof(line), "%04d-%02d-%02d %02d:%02d:%02d.%03d,%s,%s\n", t.year(), t.month(), t.day(), t.hour(), t.minute(), t.second(), (int)(simMillis % 1000), what, detail);
+        for (int i = 0; i < len && line[i]; i++)
+            hash = (hash ^ (uint8_t)line[i]) * 16777619u;
+        if (csv)
+            fputs(line, csv);
+        events++;
+    }
+
+    void relay(bool on)
+    {
+        if (on == relayOn)
+            return;
+        relayOn = on;
+        (on ? relayOnAt : relayOffAt).push_back(simMillis);
+        event("relay", on ? "on" : "off");
+    }
+    void playAudio(const char* file)
+    {
+        playing = true;
+        audioEnd = simMillis + SIM_AUDIO_LENGTH;
+        audioAt.push_back(simMillis);
+        event("audio", file);
+    }
+    bool audioPlaying() { return playing; }
+    bool audioStopped() { return stopped; }
+    void clearAudioStopped() { stopped = false; }
+
+    // Stand in for the audio task, end the audio after SIM_AUDIO_LENGTH
+    void update()
+    {
+        if (playing && simMillis >= audioEnd) {
+            playing = false;
+            stopped = true;
+            audioEndAt.push_back(simMillis);
+            event("audio", "end");
+        }
+    }
+
+    bool busy() { return playing || stopped || relayOn; }
+    uint32_t signature() { return hash; }
+};
+
+struct SimResult
+{
+    std::vector<uint32_t> bells; // Unix time of every bell
+    SimBellOutput out;
+    uint16_t days = 0;
+    uint32_t realMs = 0;
+};
+
+// Replay [from, to), from at midnight. Templates switch at 12:00 of day 0, SIM_SWITCH_DAYS, ...
+static void simulate(const DateTime& from, const DateTime& to, SimResult& res)
+{
+    BellScheduler sched(res.out, simClock);
+    Jadwal jw;
+    uint8_t tjIndex = 0;
+    simEpoch = from.unixtime();
+    uint64_t end = (uint64_t)(to.unixtime() - simEpoch) * 1000;
+    uint32_t lastSec = UINT32_MAX;
+    uint8_t lastDay = 0;
+    uint32_t start = millis();
+    for (simMillis = 0; simMillis < end;) {
+        uint32_t sec = simMillis / 1000;
+        if (sec != lastSec) {
+            lastSec = sec;
+            DateTime t(simEpoch + sec);
+            if (t.day() != lastDay) {
+                lastDay = t.day();
+                res.days++;
+                loadJadwal(templates[tjIndex], jw, t.dayOfTheWeek());
+            }
+            if ((res.days - 1) % SIM_SWITCH_DAYS == 0 && t.hour() == 12 && t.minute() == 0 && t.second() == 0) {
+                tjIndex = !tjIndex;
+                loadJadwal(templates[tjIndex], jw, t.dayOfTheWeek());
+                res.out.event("template", templates[tjIndex].name);
+            }
+            int rang = sched.check(jw, (t.hour() * 100) + t.minute());
+            if (rang >= 0) {
+                res.bells.push_back(simEpoch + sec);
+                res.out.event("bell", jw.namaBel[rang]);
+            }
+        }
+        sched.update();
+        res.out.update();
+        if (sched.pending() || res.out.busy())
+            simMillis += SIM_TICK;
+        else // Nothing happens between minutes
+            simMillis = (simMillis / 60000 + 1) * 60000;
+    }
+    res.realMs = millis() - start;
+}
+
+// Bells expected on [from, to), minute by minute from the templates
+static std::vector<uint32_t> expectedBells(const DateTime& from, const DateTime& to)
+{
+    std::vector<uint32_t> bells;
+    for (uint32_t t = from.unixtime(); t < to.unixtime(); t += 60) {
+        DateTime now(t);
+        uint32_t day = (t - from.unixtime()) / 86400;
+        uint32_t switches = (day + SIM_SWITCH_DAYS - 1) / SIM_SWITCH_DAYS + (day % SIM_SWITCH_DAYS == 0 && now.hour() >= 12);
+        const Template& tj = templates[switches % 2];
+        for (uint16_t hhmm : tj.days[tj.weekly ? now.dayOfTheWeek() : 0])
+            if (hhmm == now.hour() * 100 + now.minute())
+                bells.push_back(t);
+    }
+    return bells;
+}
+
+static bool rang(const SimResult& res, const DateTime& t)
+{
+    for (uint32_t bell : res.bells)
+        if (bell == t.unixtime())
+            return true;
+    return false;
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+// Dec 24 to Jan 8, Ujian is active over New Year with bells at 23:59 and 00:00
+void test_bells_across_new_year(void)
+{
+    DateTime from(2025, 12, 24, 0, 0, 0), to(2026, 1, 8, 0, 0, 0);
+    SimResult res;
+    simulate(from, to, res);
+    std::vector<uint32_t> expected = expectedBells(from, to);
+    TEST_ASSERT_EQUAL_UINT32(15, res.days);
+    TEST_ASSERT_EQUAL(expected.size(), res.bells.size());
+    for (size_t i = 0; i < expected.size(); i++)
+        TEST_ASSERT_EQUAL_UINT32(expected[i], res.bells[i]);
+    TEST_ASSERT_TRUE(rang(res, DateTime(2025, 12, 31, 23, 59, 0)));
+    TEST_ASSERT_TRUE(rang(res, DateTime(2026, 1, 1, 0, 0, 0)));
+    TEST_ASSERT_TRUE(rang(res, DateTime(2025, 12, 30, 12, 0, 0))); // Bell of the new template at the switch
+}
+
+// Relay on at the bell, audio after the relay settle time, relay off BELL_AUDIO_DELAY after the audio
+void test_relay_and_audio_timing(void)
+{
+    DateTime from(2025, 12, 29, 0, 0, 0), to(2026, 1, 3, 0, 0, 0);
+    SimResult res;
+    simulate(from, to, res);
+    TEST_ASSERT_EQUAL(res.bells.size(), res.out.relayOnAt.size());
+    TEST_ASSERT_EQUAL(res.bells.size(), res.out.audioAt.size());
+    TEST_ASSERT_EQUAL(res.bells.size(), res.out.audioEndAt.size());
+    TEST_ASSERT_EQUAL(res.bells.size(), res.out.relayOffAt.size());
+    for (size_t i = 0; i < res.bells.size(); i++) {
+        TEST_ASSERT_EQUAL_UINT32((uint64_t)(res.bells[i] - simEpoch) * 1000, res.out.relayOnAt[i]);
+        uint64_t settle = res.out.audioAt[i] - res.out.relayOnAt[i];
+        TEST_ASSERT_TRUE(settle >= BELL_AUDIO_DELAY && settle <= BELL_AUDIO_DELAY + 2 * SIM_TICK);
+        TEST_ASSERT_EQUAL_UINT32(SIM_AUDIO_LENGTH, res.out.audioEndAt[i] - res.out.audioAt[i]);
+        uint64_t hold = res.out.relayOffAt[i] - res.out.audioEndAt[i];
+        TEST_ASSERT_TRUE(hold >= BELL_AUDIO_DELAY && hold <= BELL_AUDIO_DELAY + 2 * SIM_TICK);
+    }
+}
+
+// A whole year at 1000x real time or more, with the golden event signature on every run
+void test_year_replay_is_fast_and_deterministic(void)
+{
+    DateTime from(2026, 1, 1, 0, 0, 0), to(2027, 1, 1, 0, 0, 0);
+    SimResult first, second;
+    second.out.csv = NULL; // Same lines as the first run
+    simulate(from, to, first);
+    simulate(from, to, second);
+    TEST_ASSERT_EQUAL_UINT32(365, first.days);
+    TEST_ASSERT_EQUAL(expectedBells(from, to).size(), first.bells.size());
+    TEST_ASSERT_EQUAL_HEX32(SIM_YEAR_SIGNATURE, first.out.signature());
+    TEST_ASSERT_EQUAL_UINT32(SIM_YEAR_EVENTS, first.out.events);
+    TEST_ASSERT_EQUAL_HEX32(first.out.signature(), second.out.signature());
+    TEST_ASSERT_EQUAL_UINT32(first.out.events, second.out.events);
+    printf("%u days, %u bells, %u events, signature %08X, %u ms\n", first.days, (unsigned)first.bells.size(),
+        first.out.events, first.out.signature(), first.realMs);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(365u * 86400, first.realMs); // Virtual seconds as real ms
+}
+
+int main(int argc, char** argv)
+{
+    const char* csv = getenv("BELL_SIM_CSV");
+    if (csv && strcmp(csv, "-") == 0)
+        simCsv = stdout;
+    else if (csv && !(simCsv = fopen(csv, "w")))
+        printf("Can't write %s\n", csv);
+    if (simCsv)
+        fputs("time,what,detail\n", simCsv);
+    UNITY_BEGIN();
+    RUN_TEST(test_bells_across_new_year);
+    RUN_TEST(test_relay_and_audio_timing);
+    RUN_TEST(test_year_replay_is_fast_and_deterministic);
+    if (simCsv && simCsv != stdout)
+        fclose(simCsv);
+    return UNITY_END();
+}
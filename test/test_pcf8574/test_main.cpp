@@ -0,0 +1,125 @@
+#include <unity.h>
+#include <vector>
+#include <pcf8574.h>
+
+// Shadow register of the PCF8574 driver against a fake bus that record every transfer
+class FakeBus : public pcf8574Bus
+{
+public:
+    std::vector<uint8_t> writes;
+    uint8_t port = 0; // Pins as read back from the expander
+    uint32_t reads = 0;
+
+    void writeByte(uint8_t address, uint8_t data)
+    {
+        TEST_ASSERT_EQUAL_UINT8(0x20, address);
+        writes.push_back(data);
+        port = data;
+    }
+    uint8_t readByte(uint8_t address)
+    {
+        TEST_ASSERT_EQUAL_UINT8(0x20, address);
+        reads++;
+        return port;
+    }
+};
+
+static FakeBus* bus;
+static pcf8574* expander;
+
+void setUp(void)
+{
+    bus = new FakeBus();
+    expander = new pcf8574();
+    expander->init(0x20, *bus);
+}
+
+void tearDown(void)
+{
+    delete expander;
+    delete bus;
+}
+
+void test_init_clears_the_port(void)
+{
+    TEST_ASSERT_EQUAL(1, bus->writes.size());
+    TEST_ASSERT_EQUAL_UINT8(0x00, bus->writes[0]);
+    TEST_ASSERT_EQUAL_UINT32(1, expander->transactions);
+    TEST_ASSERT_EQUAL_UINT8(0x00, expander->readByteFast());
+}
+
+void test_staged_pins_go_in_one_transaction(void)
+{
+    expander->stage(0, true);
+    expander->stage(3, true);
+    expander->stage(7, true);
+    TEST_ASSERT_TRUE(expander->pending());
+    TEST_ASSERT_EQUAL(1, bus->writes.size()); // Nothing sent before commit()
+    TEST_ASSERT_TRUE(expander->commit());
+    TEST_ASSERT_EQUAL(2, bus->writes.size());
+    TEST_ASSERT_EQUAL_UINT8(0x89, bus->writes[1]);
+    TEST_ASSERT_EQUAL_UINT32(2, expander->transactions);
+    TEST_ASSERT_EQUAL_UINT32(2, expander->avoided);
+    TEST_ASSERT_FALSE(expander->pending());
+    TEST_ASSERT_TRUE(expander->readFast(3));
+}
+
+void test_unchanged_port_is_skipped(void)
+{
+    expander->stage(2, true);
+    expander->stage(2, false); // Back to the port value
+    TEST_ASSERT_FALSE(expander->pending());
+    TEST_ASSERT_FALSE(expander->commit());
+    TEST_ASSERT_EQUAL(1, bus->writes.size());
+    TEST_ASSERT_EQUAL_UINT32(1, expander->transactions);
+    TEST_ASSERT_EQUAL_UINT32(2, expander->avoided);
+}
+
+void test_commit_without_stage_does_nothing(void)
+{
+    TEST_ASSERT_FALSE(expander->commit());
+    TEST_ASSERT_EQUAL(1, bus->writes.size());
+    TEST_ASSERT_EQUAL_UINT32(0, expander->avoided);
+}
+
+void test_stage_starts_from_the_port(void)
+{
+    expander->write(1, true);
+    TEST_ASSERT_EQUAL_UINT8(0x02, bus->writes.back());
+    expander->stage(4, true);
+    expander->commit();
+    TEST_ASSERT_EQUAL_UINT8(0x12, bus->writes.back()); // Pin 1 kept
+    TEST_ASSERT_EQUAL_UINT32(3, expander->transactions);
+    TEST_ASSERT_EQUAL_UINT32(0, expander->avoided);
+}
+
+void test_stage_byte_and_read_back(void)
+{
+    expander->stageByte(0xA5);
+    expander->stage(0, false);
+    TEST_ASSERT_TRUE(expander->commit());
+    TEST_ASSERT_EQUAL_UINT8(0xA4, bus->writes.back());
+    TEST_ASSERT_EQUAL_UINT32(1, expander->avoided);
+
+    bus->port = 0x0F; // Inputs changed on the expander side
+    TEST_ASSERT_EQUAL_UINT8(0x0F, expander->readByte());
+    TEST_ASSERT_EQUAL_UINT32(1, bus->reads);
+    TEST_ASSERT_EQUAL_UINT32(3, expander->transactions);
+    TEST_ASSERT_TRUE(expander->read(3));
+    TEST_ASSERT_FALSE(expander->readFast(4));
+    expander->stage(4, true);
+    expander->commit();
+    TEST_ASSERT_EQUAL_UINT8(0x1F, bus->writes.back()); // Staged from the value read
+}
+
+int main(int argc, char** argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_init_clears_the_port);
+    RUN_TEST(test_staged_pins_go_in_one_transaction);
+    RUN_TEST(test_unchanged_port_is_skipped);
+    RUN_TEST(test_commit_without_stage_does_nothing);
+    RUN_TEST(test_stage_starts_from_the_port);
+    RUN_TEST(test_stage_byte_and_read_back);
+    return UNITY_END();
+}
@@ -0,0 +1,198 @@
+#include <unity.h>
+#include <new>
+#include <schedule_io.h>
+
+// Streaming import of a 10,000 row schedule within a fixed heap budget. The file is generated on the fly by the
+// input stream, so the only memory the import can use is the reader itself, every allocation is counted
+
+#define IMPORT_ROWS 10000
+#define IMPORT_HEAP_BUDGET 1024 // Bytes, reader object included
+
+static size_t heapUsed, heapPeak, allocCount;
+
+void* operator new(size_t size)
+{
+    size_t* block = (size_t*)malloc(size + sizeof(size_t));
+    if (!block)
+        throw std::bad_alloc();
+    *block = size;
+    heapUsed += size;
+    allocCount++;
+    if (heapUsed > heapPeak)
+        heapPeak = heapUsed;
+    return block + 1;
+}
+void operator delete(void* p) noexcept
+{
+    if (!p)
+        return;
+    size_t* block = (size_t*)p - 1;
+    heapUsed -= *block;
+    free(block);
+}
+void operator delete(void* p, size_t) noexcept { operator delete(p); }
+
+static const char* const audioFiles[] = { "/bel/masuk.mp3", "/bel/istirahat.mp3", "/bel/pulang.mp3", "/bel/\"khusus\", 1.mp3" };
+
+static void expectedRow(uint32_t i, int8_t& hari, uint16_t& jadwal, char* nama, const char*& audio)
+{
+    hari = i % 8 == 7 ? SCHEDULE_EVERY_DAY : i % 7;
+    jadwal = (i / 60 % 24) * 100 + i % 60;
+    sprintf(nama, "Bel %lu", (unsigned long)i);
+    audio = audioFiles[i % 4];
+}
+
+// Schedule file produced one row at a time by ScheduleWriter, never held whole in memory
+class GeneratedSchedule : public Stream
+{
+    struct LineBuffer : public Print
+    {
+        char data[512];
+        size_t len = 0;
+        size_t write(uint8_t c)
+        {
+            if (len < sizeof(data))
+                data[len++] = c;
+            return 1;
+        }
+    } line;
+    ScheduleWriter writer;
+    uint32_t rows, nextRow = 0;
+    size_t pos = 0;
+    bool ended = false;
+
+    bool fill()
+    {
+        while (pos == line.len) {
+            if (ended)
+                return false;
+            line.len = pos = 0;
+            if (nextRow < rows) {
+                int8_t hari;
+                uint16_t jadwal;
+                char nama[SCHEDULE_NAME_LEN];
+                const char* audio;
+                expectedRow(nextRow++, hari, jadwal, nama, audio);
+                writer.row(hari, jadwal, nama, audio);
+            }
+            else {
+                writer.end();
+                ended = true;
+            }
+        }
+        return true;
+    }
+
+public:
+    size_t bytes = 0;
+
+    GeneratedSchedule(bool json, uint32_t _rows) : writer(line, json), rows(_rows) { writer.begin("Ujian Akhir", true); }
+    int available() { return fill() ? line.len - pos : 0; }
+    int peek() { return fill() ? (uint8_t)line.data[pos] : -1; }
+    int read()
+    {
+        if (!fill())
+            return -1;
+        bytes++;
+        return (uint8_t)line.data[pos++];
+    }
+    size_t write(uint8_t) { return 0; }
+};
+
+// Fixed text input for the error cases
+class TextStream : public Stream
+{
+    const char* text;
+
+public:
+    TextStream(const char* _text) : text(_text) {}
+    int available() { return strlen(text); }
+    int peek() { return *text ? (uint8_t)*text : -1; }
+    int read() { return *text ? (uint8_t)*text++ : -1; }
+    size_t write(uint8_t) { return 0; }
+};
+
+static void importWithinBudget(bool json)
+{
+    GeneratedSchedule file(json, IMPORT_ROWS);
+    size_t baseline = heapUsed;
+    heapPeak = heapUsed;
+    ScheduleReader* reader = json ? (ScheduleReader*)new JsonScheduleReader(file) : new CsvScheduleReader(file);
+    size_t allocsAfterCreate = allocCount;
+
+    ScheduleRow row;
+    uint32_t count = 0;
+    while (reader->next(row)) {
+        int8_t hari;
+        uint16_t jadwal;
+        char nama[SCHEDULE_NAME_LEN];
+        const char* audio;
+        expectedRow(count++, hari, jadwal, nama, audio);
+        TEST_ASSERT_EQUAL_INT(hari, row.hari);
+        TEST_ASSERT_EQUAL_UINT16(jadwal, row.jadwal);
+        TEST_ASSERT_EQUAL_STRING(nama, row.nama);
+        TEST_ASSERT_EQUAL_STRING(audio, row.audio);
+    }
+    TEST_ASSERT_EQUAL_STRING("", reader->error());
+    TEST_ASSERT_EQUAL_UINT32(IMPORT_ROWS, count);
+    TEST_ASSERT_EQUAL_UINT32(allocsAfterCreate, allocCount); // Nothing allocated per row
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(IMPORT_HEAP_BUDGET, heapPeak - baseline);
+    TEST_ASSERT_GREATER_THAN(300000, file.bytes);
+    if (json) {
+        TEST_ASSERT_EQUAL_STRING("Ujian Akhir", reader->templateName);
+        TEST_ASSERT_EQUAL_INT(1, reader->tipe);
+    }
+    delete reader;
+    TEST_ASSERT_EQUAL_UINT32(baseline, heapUsed);
+}
+
+void setUp(void) {}
+void tearDown(void) {}
+
+void test_csv_import_10000_rows_within_budget(void) { importWithinBudget(false); }
+void test_json_import_10000_rows_within_budget(void) { importWithinBudget(true); }
+
+void test_csv_error_reports_line(void)
+{
+    TextStream file("hari,jam,nama,audio\nSenin,07:00,Masuk,/a.mp3\n# komentar\nSelasa,25:00,Salah,/a.mp3\n");
+    CsvScheduleReader reader(file);
+    ScheduleRow row;
+    TEST_ASSERT_TRUE(reader.next(row));
+    TEST_ASSERT_EQUAL_UINT32(2, reader.line());
+    TEST_ASSERT_FALSE(reader.next(row));
+    TEST_ASSERT_EQUAL_STRING("Baris 4 : jam tidak valid", reader.error());
+}
+
+void test_csv_overlong_line_is_rejected(void)
+{
+    static char text[600];
+    strcpy(text, "Senin,07:00,");
+    memset(text + strlen(text), 'x', 400);
+    strcat(text, ",/a.mp3\n");
+    TextStream file(text);
+    CsvScheduleReader reader(file);
+    ScheduleRow row;
+    TEST_ASSERT_FALSE(reader.next(row));
+    TEST_ASSERT_EQUAL_STRING("Baris 1 : baris terlalu panjang", reader.error());
+}
+
+void test_json_truncated_file(void)
+{
+    TextStream file("{\"name\":\"A\",\"bel\":[{\"hari\":\"Senin\",\"jam\":\"07:00\",\"nama\":\"Masuk\",\"audio\":\"/a.mp3\"},");
+    JsonScheduleReader reader(file);
+    ScheduleRow row;
+    TEST_ASSERT_TRUE(reader.next(row));
+    TEST_ASSERT_FALSE(reader.next(row));
+    TEST_ASSERT_EQUAL_STRING("Baris 1 : file terpotong", reader.error());
+}
+
+int main(int argc, char** argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_csv_import_10000_rows_within_budget);
+    RUN_TEST(test_json_import_10000_rows_within_budget);
+    RUN_TEST(test_csv_error_reports_line);
+    RUN_TEST(test_csv_overlong_line_is_rejected);
+    RUN_TEST(test_json_truncated_file);
+    return UNITY_END();
+}
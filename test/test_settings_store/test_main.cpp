@@ -0,0 +1,194 @@
+#include <unity.h>
+#include <settings_store.h>
+
+// SettingsStore against MemorySettingsBackend, with the debounce driven by a virtual clock
+static uint32_t fakeMillis;
+static uint32_t fakeClock() { return fakeMillis; }
+
+static const uint32_t commitDelay = 2000;
+static MemorySettingsBackend<>* backend;
+static SettingsStore* store;
+static int volume;
+static char name[16];
+static int volumeId, nameId;
+
+void setUp(void)
+{
+    fakeMillis = 1000;
+    backend = new MemorySettingsBackend<>();
+    store = new SettingsStore(backend, commitDelay, fakeClock);
+    volume = 0;
+    memset(name, 0, sizeof(name));
+    volumeId = store->bind("volume", volume);
+    nameId = store->bind("name", name);
+}
+
+void tearDown(void)
+{
+    delete store;
+    delete backend;
+}
+
+void test_write_waits_for_debounce(void)
+{
+    TEST_ASSERT_TRUE(store->begin());
+    volume = 7;
+    store->touch(volumeId);
+    fakeMillis += commitDelay - 1;
+    store->loop();
+    TEST_ASSERT_EQUAL_UINT32(0, backend->storeCount);
+    fakeMillis += 1;
+    store->loop();
+    TEST_ASSERT_EQUAL_UINT32(1, backend->storeCount);
+    TEST_ASSERT_EQUAL_UINT32(1, store->writeCount);
+
+    int stored = 0;
+    TEST_ASSERT_EQUAL(sizeof(stored), backend->load("volume", &stored, sizeof(stored)));
+    TEST_ASSERT_EQUAL_INT(7, stored);
+    store->loop(); // Nothing left to write
+    TEST_ASSERT_EQUAL_UINT32(1, backend->storeCount);
+}
+
+// A slider drag : every change restart the debounce and only the last value is written
+void test_changes_coalesce_into_one_write(void)
+{
+    store->begin();
+    for (int i = 1; i <= 50; i++) {
+        volume = i;
+        store->touch(volumeId);
+        fakeMillis += 100;
+        store->loop();
+    }
+    TEST_ASSERT_EQUAL_UINT32(0, backend->storeCount);
+    TEST_ASSERT_EQUAL_UINT32(49, store->coalescedCount);
+    fakeMillis += commitDelay;
+    store->loop();
+    TEST_ASSERT_EQUAL_UINT32(1, backend->storeCount);
+
+    int stored = 0;
+    backend->load("volume", &stored, sizeof(stored));
+    TEST_ASSERT_EQUAL_INT(50, stored);
+}
+
+void test_entries_debounce_independently(void)
+{
+    store->begin();
+    volume = 3;
+    store->touch(volumeId);
+    fakeMillis += commitDelay / 2;
+    strcpy(name, "Reguler");
+    store->touch(nameId);
+    fakeMillis += commitDelay / 2;
+    store->loop();
+    TEST_ASSERT_EQUAL_UINT32(1, backend->storeCount); // volume only
+    fakeMillis += commitDelay / 2;
+    store->loop();
+    TEST_ASSERT_EQUAL_UINT32(2, backend->storeCount);
+}
+
+void test_debounce_across_clock_wrap(void)
+{
+    store->begin();
+    fakeMillis = UINT32_MAX - 500;
+    volume = 9;
+    store->touch(volumeId);
+    fakeMillis += commitDelay - 1; // Wrapped
+    store->loop();
+    TEST_ASSERT_EQUAL_UINT32(0, backend->storeCount);
+    fakeMillis += 1;
+    store->loop();
+    TEST_ASSERT_EQUAL_UINT32(1, backend->storeCount);
+}
+
+void test_load_all_then_served_from_cache(void)
+{
+    int storedVolume = 12;
+    backend->store("volume", &storedVolume, sizeof(storedVolume));
+    backend->store("name", "Ramadhan\0\0\0\0\0\0\0", sizeof(name));
+    store->begin();
+    TEST_ASSERT_EQUAL_UINT8(2, store->loadAll());
+    TEST_ASSERT_EQUAL_INT(12, volume);
+    TEST_ASSERT_EQUAL_STRING("Ramadhan", name);
+
+    uint32_t loads = backend->loadCount;
+    volume = 4; // Changed on the variable, load() must not read the backend again
+    TEST_ASSERT_TRUE(store->load(volumeId));
+    TEST_ASSERT_TRUE(store->load(nameId));
+    TEST_ASSERT_EQUAL_UINT32(loads, backend->loadCount);
+    TEST_ASSERT_EQUAL_INT(4, volume);
+}
+
+void test_load_missing_or_resized_key_fails(void)
+{
+    uint8_t wrongSize = 1;
+    backend->store("volume", &wrongSize, sizeof(wrongSize));
+    store->begin();
+    volume = 5;
+    TEST_ASSERT_FALSE(store->load(volumeId));
+    TEST_ASSERT_FALSE(store->load(nameId));
+    TEST_ASSERT_EQUAL_INT(5, volume);
+    TEST_ASSERT_FALSE(store->load(99));
+}
+
+void test_touched_entry_is_not_overwritten_by_load(void)
+{
+    int storedVolume = 12;
+    backend->store("volume", &storedVolume, sizeof(storedVolume));
+    store->begin();
+    volume = 6;
+    store->touch(volumeId);
+    TEST_ASSERT_TRUE(store->load(volumeId));
+    TEST_ASSERT_EQUAL_INT(6, volume);
+}
+
+void test_flush_writes_pending_now(void)
+{
+    store->begin();
+    volume = 1;
+    store->touch(volumeId);
+    strcpy(name, "Ujian");
+    store->touch(nameId);
+    TEST_ASSERT_TRUE(store->flush());
+    TEST_ASSERT_EQUAL_UINT32(2, backend->storeCount);
+    TEST_ASSERT_TRUE(store->flush()); // Nothing pending
+    TEST_ASSERT_EQUAL_UINT32(2, backend->storeCount);
+}
+
+void test_nothing_written_before_begin(void)
+{
+    volume = 1;
+    store->touch(volumeId);
+    fakeMillis += commitDelay;
+    store->loop();
+    TEST_ASSERT_EQUAL_UINT32(0, backend->storeCount);
+    TEST_ASSERT_FALSE(store->flush());
+    store->begin();
+    store->loop();
+    TEST_ASSERT_EQUAL_UINT32(1, backend->storeCount);
+}
+
+void test_bind_limit(void)
+{
+    int extra[SettingsStore::maxEntries];
+    int lastId = 0;
+    for (uint8_t i = 0; i < SettingsStore::maxEntries - 2; i++)
+        lastId = store->bind("extra", extra[i]);
+    TEST_ASSERT_EQUAL_INT(SettingsStore::maxEntries - 1, lastId);
+    TEST_ASSERT_EQUAL_INT(-1, store->bind("full", extra[0]));
+}
+
+int main(int argc, char** argv)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_write_waits_for_debounce);
+    RUN_TEST(test_changes_coalesce_into_one_write);
+    RUN_TEST(test_entries_debounce_independently);
+    RUN_TEST(test_debounce_across_clock_wrap);
+    RUN_TEST(test_load_all_then_served_from_cache);
+    RUN_TEST(test_load_missing_or_resized_key_fails);
+    RUN_TEST(test_touched_entry_is_not_overwritten_by_load);
+    RUN_TEST(test_flush_writes_pending_now);
+    RUN_TEST(test_nothing_written_before_begin);
+    RUN_TEST(test_bind_limit);
+    return UNITY_END();
+}
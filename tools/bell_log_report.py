@@ -0,0 +1,115 @@
+#!/usr/bin/env python3
+"""Read the bell history written by the device on the SD card (see include/bell_log.h).
+
+Each day is a file PATH_BELL_LOG/YYYYMMDD.bin. Give the files or the folder, every day found is
+summarized: bells rang, how late they were against the jadwal, audio start latency and duration,
+preemptions and errors.
+
+  python tools/bell_log_report.py /media/sd/bellog
+  python tools/bell_log_report.py /media/sd/bellog/20260105.bin --events
+
+Times are printed in the device local time, the same as the jadwal, since that's what the RTC keeps.
+"""
+import argparse
+import os
+import struct
+import sys
+from datetime import datetime, timezone
+
+MAGIC = 0x4C4C4542
+HEADER = struct.Struct("<IHH")
+RECORD = struct.Struct("<IHHHHIB3x32s")
+MANUAL = 0xFFFF
+NO_AUDIO = 0xFFFF
+FLAGS = {1: "preempted", 2: "preempts", 4: "not_mp3", 8: "begin_failed"}
+
+
+def read_file(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    if len(data) < HEADER.size:
+        sys.exit("%s: too short" % path)
+    magic, version, size = HEADER.unpack_from(data)
+    if magic != MAGIC:
+        sys.exit("%s: not a bell log" % path)
+    if version != 1 or size < RECORD.size:
+        sys.exit("%s: unsupported version %d, record size %d" % (path, version, size))
+    records = []
+    for offset in range(HEADER.size, len(data) - size + 1, size):
+        trigger, trigger_ms, scheduled, latency, flags, duration, index, file = RECORD.unpack_from(data, offset)
+        records.append({
+            "time": datetime.fromtimestamp(trigger, timezone.utc).replace(tzinfo=None),
+            "ms": trigger_ms,
+            "scheduled": None if scheduled == MANUAL else scheduled,
+            "latency": None if latency == NO_AUDIO else latency,
+            "flags": flags,
+            "duration": duration,
+            "index": index,
+            "file": file.split(b"\0", 1)[0].decode("utf-8", "replace"),
+        })
+    if (len(data) - HEADER.size) % size:
+        print("%s: ignoring a partial record at the end" % path, file=sys.stderr)
+    return records
+
+
+def lateness(rec):
+    """Seconds from the scheduled minute to the relay, None for manual bells"""
+    if rec["scheduled"] is None:
+        return None
+    t = rec["time"]
+    start = t.replace(hour=rec["scheduled"] // 100, minute=rec["scheduled"] % 100, second=0, microsecond=0)
+    return (t - start).total_seconds() + rec["ms"] / 1000
+
+
+def stats(values):
+    if not values:
+        return "-"
+    values = sorted(values)
+    return "min %d avg %d max %d" % (values[0], sum(values) / len(values), values[-1])
+
+
+def flag_names(flags):
+    return ",".join(name for bit, name in FLAGS.items() if flags & bit) or "-"
+
+
+def report(day, records, events):
+    scheduled = [r for r in records if r["scheduled"] is not None]
+    late = [lateness(r) for r in scheduled]
+    errors = sum(1 for r in records if r["flags"] & 12)
+    print("%s: %d bells (%d scheduled, %d manual)" % (day, len(records), len(scheduled), len(records) - len(scheduled)))
+    if late:
+        print("  lateness s    : min %.3f avg %.3f max %.3f, %d over 1 s" % (
+            min(late), sum(late) / len(late), max(late), sum(1 for v in late if v >= 1)))
+    print("  latency ms    : %s" % stats([r["latency"] for r in records if r["latency"] is not None]))
+    print("  duration ms   : %s" % stats([r["duration"] for r in records if r["latency"] is not None]))
+    print("  preempted     : %d" % sum(1 for r in records if r["flags"] & 1))
+    print("  errors        : %d" % errors)
+    if events:
+        for r in records:
+            sched = "manual" if r["scheduled"] is None else "%02d:%02d" % (r["scheduled"] // 100, r["scheduled"] % 100)
+            latency = "-" if r["latency"] is None else r["latency"]
+            print("    %s.%03d %6s #%-3d latency %5s duration %7d %-20s %s" % (
+                r["time"].strftime("%H:%M:%S"), r["ms"], sched, r["index"], latency, r["duration"],
+                flag_names(r["flags"]), r["file"]))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("paths", nargs="+", help="day files or the bell log folder")
+    parser.add_argument("--events", action="store_true", help="list every bell")
+    args = parser.parse_args()
+
+    files = []
+    for path in args.paths:
+        if os.path.isdir(path):
+            files += sorted(os.path.join(path, name) for name in os.listdir(path) if name.endswith(".bin"))
+        else:
+            files.append(path)
+    if not files:
+        sys.exit("No bell log found")
+    for path in files:
+        report(os.path.splitext(os.path.basename(path))[0], read_file(path), args.events)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,325 @@
+#!/usr/bin/env python3
+"""Subset and re-encode an LVGL font generated by lv_font_conv (LVGL 8 C output).
+
+Keeps only the requested characters, lays them out as dense FORMAT0_TINY ranges so glyph lookup
+never searches a sparse unicode list, and optionally changes bpp or drops kerning. Works on the
+generated C file, so the original TTF isn't needed.
+
+  python tools/font_subset.py src/Montserrat_SemiBold48.c --chars "0123456789:" --bpp 8
+
+The output replaces the input file unless -o is given. Use the "fbench" serial command on the
+device to compare render time of the result, see lvgl_font_benchmark() in include/lvgl_core.h.
+"""
+import argparse
+import re
+import sys
+
+CMAP_TYPES = ("FORMAT0_TINY", "FORMAT0_FULL", "SPARSE_TINY", "SPARSE_FULL")
+
+
+def strip_comments(text):
+    return re.sub(r"/\*.*?\*/", "", text, flags=re.S)
+
+
+def array(src, name):
+    match = re.search(r"\b%s\[\]\s*=\s*\{(.*?)\};" % re.escape(name), src, re.S)
+    if not match:
+        return None
+    body = strip_comments(match.group(1))
+    return [int(v, 0) for v in re.split(r"[\s,]+", body) if v]
+
+
+def scalar(src, name, default=None):
+    match = re.search(r"\.%s\s*=\s*(-?\w+)" % name, src)
+    if not match:
+        if default is None:
+            sys.exit("Missing .%s" % name)
+        return default
+    return match.group(1)
+
+
+def parse(path):
+    raw = open(path, encoding="utf-8").read()
+    font = {}
+    font["name"] = re.search(r"lv_font_t\s+(\w+)\s*=", raw).group(1)
+    font["guard"] = re.search(r"#ifndef\s+(\w+)", raw).group(1)
+    font["size"] = re.search(r"Size:\s*(\d+)", raw).group(1)
+    for key in ("line_height", "base_line", "underline_position", "underline_thickness", "kern_scale", "bpp",
+                "bitmap_format", "kern_classes"):
+        font[key] = int(scalar(raw, key, "0"))
+    if font["bitmap_format"] != 0:
+        sys.exit("Compressed bitmaps aren't supported, regenerate with --no-compress")
+
+    font["bitmap"] = array(raw, "glyph_bitmap")
+    font["glyphs"] = [dict(zip(("bitmap_index", "adv_w", "box_w", "box_h", "ofs_x", "ofs_y"), map(int, g)))
+                      for g in re.findall(r"\{\.bitmap_index = (\d+), \.adv_w = (\d+), \.box_w = (\d+), "
+                                          r"\.box_h = (\d+), \.ofs_x = (-?\d+), \.ofs_y = (-?\d+)\}", raw)]
+
+    # Unicode to glyph id, following lv_font_fmt_txt.c get_glyph_dsc_id()
+    font["map"] = {}
+    cmap_re = (r"\.range_start = (\d+), \.range_length = (\d+), \.glyph_id_start = (\d+),\s*"
+               r"\.unicode_list = (\w+), \.glyph_id_ofs_list = (\w+), \.list_length = (\d+), "
+               r"\.type = LV_FONT_FMT_TXT_CMAP_(\w+)")
+    for start, length, gid_start, ulist, ofslist, list_len, ctype in re.findall(cmap_re, raw):
+        start, length, gid_start, list_len = int(start), int(length), int(gid_start), int(list_len)
+        if ctype == "FORMAT0_TINY":
+            pairs = [(start + i, gid_start + i) for i in range(length)]
+        elif ctype == "FORMAT0_FULL":
+            pairs = [(start + i, gid_start + ofs) for i, ofs in enumerate(array(raw, ofslist))]
+        elif ctype == "SPARSE_TINY":
+            pairs = [(start + u, gid_start + i) for i, u in enumerate(array(raw, ulist)[:list_len])]
+        elif ctype == "SPARSE_FULL":
+            ofs = array(raw, ofslist)
+            pairs = [(start + u, gid_start + ofs[i]) for i, u in enumerate(array(raw, ulist)[:list_len])]
+        else:
+            sys.exit("Unknown cmap type %s" % ctype)
+        font["map"].update(pairs)
+
+    font["kern_pairs"] = None
+    font["kern_class"] = None
+    if re.search(r"\.kern_dsc = &kern_pairs", raw):
+        if int(scalar(raw, "glyph_ids_size")) != 0:
+            sys.exit("16 bit kerning glyph ids aren't supported")
+        ids = array(raw, "kern_pair_glyph_ids")
+        font["kern_pairs"] = list(zip(ids[0::2], ids[1::2], array(raw, "kern_pair_values")))
+    elif re.search(r"\.kern_dsc = &kern_classes", raw):
+        font["kern_class"] = {
+            "left": array(raw, "kern_left_class_mapping"),
+            "right": array(raw, "kern_right_class_mapping"),
+            "values": array(raw, "kern_class_values"),
+            "left_cnt": int(scalar(raw, "left_class_cnt")),
+            "right_cnt": int(scalar(raw, "right_class_cnt")),
+        }
+    return font
+
+
+def glyph_pixels(font, gid):
+    """Unpack glyph bitmap to a list of alpha values with the font bpp"""
+    glyph = font["glyphs"][gid]
+    bpp = font["bpp"]
+    data = font["bitmap"][glyph["bitmap_index"]:]
+    pixels = []
+    for i in range(glyph["box_w"] * glyph["box_h"]):
+        bit = i * bpp
+        pixels.append((data[bit >> 3] >> (8 - bpp - (bit & 7))) & ((1 << bpp) - 1))
+    return pixels
+
+
+def pack_pixels(pixels, bpp):
+    out = bytearray((len(pixels) * bpp + 7) // 8)
+    for i, value in enumerate(pixels):
+        bit = i * bpp
+        out[bit >> 3] |= value << (8 - bpp - (bit & 7))
+    return list(out)
+
+
+def rescale(value, src_bpp, dst_bpp):
+    src_max, dst_max = (1 << src_bpp) - 1, (1 << dst_bpp) - 1
+    return (value * dst_max + src_max // 2) // src_max
+
+
+def dense_ranges(codes):
+    ranges = []
+    for code in codes:
+        if ranges and ranges[-1][0] + ranges[-1][1] == code:
+            ranges[-1][1] += 1
+        else:
+            ranges.append([code, 1])
+    return ranges
+
+
+def fmt_array(values, per_line, indent="    "):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append(indent + ", ".join(values[i:i + per_line]))
+    return ",\n".join(lines)
+
+
+def write(font, path, chars, bpp, kerning, opts):
+    codes = sorted(set(ord(c) for c in chars))
+    missing = [chr(c) for c in codes if c not in font["map"]]
+    if missing:
+        sys.exit("Font doesn't contain %r" % "".join(missing))
+
+    # New glyph ids follow the unicode order, so each dense range map to consecutive ids
+    old_ids = [font["map"][c] for c in codes]
+    new_id = {old: i + 1 for i, old in enumerate(old_ids)}
+
+    bitmap_lines, glyph_lines, bitmap = [], [], []
+    for code, old in zip(codes, old_ids):
+        glyph = font["glyphs"][old]
+        pixels = [rescale(v, font["bpp"], bpp) for v in glyph_pixels(font, old)]
+        packed = pack_pixels(pixels, bpp)
+        char = chr(code).replace("\\", "\\\\").replace("\"", "\\\"")
+        bitmap_lines.append("    /* U+%04X \"%s\" */\n%s" % (code, char, fmt_array(["0x%x" % b for b in packed], 8)))
+        glyph_lines.append("    {.bitmap_index = %d, .adv_w = %d, .box_w = %d, .box_h = %d, .ofs_x = %d, .ofs_y = %d}" % (
+            len(bitmap), glyph["adv_w"], glyph["box_w"], glyph["box_h"], glyph["ofs_x"], glyph["ofs_y"]))
+        bitmap += packed
+
+    cmaps, gid = [], 1
+    for start, length in dense_ranges(codes):
+        cmaps.append("    {\n        .range_start = %d, .range_length = %d, .glyph_id_start = %d,\n"
+                     "        .unicode_list = NULL, .glyph_id_ofs_list = NULL, .list_length = 0, "
+                     ".type = LV_FONT_FMT_TXT_CMAP_FORMAT0_TINY\n    }" % (start, length, gid))
+        gid += length
+
+    kern_src, kern_ref, kern_classes = "", "NULL", 0
+    if kerning and font["kern_pairs"]:
+        pairs = [(new_id[l], new_id[r], v) for l, r, v in font["kern_pairs"] if l in new_id and r in new_id]
+        pairs.sort()
+        if pairs:
+            kern_src = ("\n\n/*Pair left and right glyphs for kerning*/\nstatic const uint8_t kern_pair_glyph_ids[] =\n{\n%s\n};\n\n"
+                        "/* Kerning between the respective left and right glyphs\n * 4.4 format which needs to scaled with `kern_scale`*/\n"
+                        "static const int8_t kern_pair_values[] =\n{\n%s\n};\n\n"
+                        "/*Collect the kern pair's data in one place*/\nstatic const lv_font_fmt_txt_kern_pair_t kern_pairs =\n{\n"
+                        "    .glyph_ids = kern_pair_glyph_ids,\n    .values = kern_pair_values,\n    .pair_cnt = %d,\n"
+                        "    .glyph_ids_size = 0\n};") % (
+                ",\n".join("    %d, %d" % (l, r) for l, r, _ in pairs),
+                fmt_array([str(v) for _, _, v in pairs], 8), len(pairs))
+            kern_ref = "&kern_pairs"
+    elif kerning and font["kern_class"]:
+        kc = font["kern_class"]
+        left = [0] + [kc["left"][old] for old in old_ids]
+        right = [0] + [kc["right"][old] for old in old_ids]
+        kern_src = ("\n\n/*Map glyph_ids to kern left classes*/\nstatic const uint8_t kern_left_class_mapping[] =\n{\n%s\n};\n\n"
+                    "/*Map glyph_ids to kern right classes*/\nstatic const uint8_t kern_right_class_mapping[] =\n{\n%s\n};\n\n"
+                    "/*Kern values between classes*/\nstatic const int8_t kern_class_values[] =\n{\n%s\n};\n\n\n"
+                    "/*Collect the kern class' data in one place*/\nstatic const lv_font_fmt_txt_kern_classes_t kern_classes =\n{\n"
+                    "    .class_pair_values   = kern_class_values,\n    .left_class_mapping  = kern_left_class_mapping,\n"
+                    "    .right_class_mapping = kern_right_class_mapping,\n    .left_class_cnt      = %d,\n"
+                    "    .right_class_cnt     = %d,\n};") % (
+            fmt_array([str(v) for v in left], 8), fmt_array([str(v) for v in right], 8),
+            fmt_array([str(v) for v in kc["values"]], 8), kc["left_cnt"], kc["right_cnt"])
+        kern_ref, kern_classes = "&kern_classes", 1
+
+    out = """/*******************************************************************************
+ * Size: {size} px
+ * Bpp: {bpp}
+ * Opts: {opts}
+ ******************************************************************************/
+
+#include <lvgl.h>
+
+#ifndef {guard}
+#define {guard} 1
+#endif
+
+#if {guard}
+
+/*-----------------
+ *    BITMAPS
+ *----------------*/
+
+/*Store the image of the glyphs*/
+static LV_ATTRIBUTE_LARGE_CONST const uint8_t glyph_bitmap[] = {{
+{bitmap}
+}};
+
+
+/*---------------------
+ *  GLYPH DESCRIPTION
+ *--------------------*/
+
+static const lv_font_fmt_txt_glyph_dsc_t glyph_dsc[] = {{
+    {{.bitmap_index = 0, .adv_w = 0, .box_w = 0, .box_h = 0, .ofs_x = 0, .ofs_y = 0}} /* id = 0 reserved */,
+{glyphs}
+}};
+
+/*---------------------
+ *  CHARACTER MAPPING
+ *--------------------*/
+
+
+
+/*Collect the unicode lists and glyph_id offsets*/
+static const lv_font_fmt_txt_cmap_t cmaps[] =
+{{
+{cmaps}
+}};
+
+/*-----------------
+ *    KERNING
+ *----------------*/
+{kern}
+
+/*--------------------
+ *  ALL CUSTOM DATA
+ *--------------------*/
+
+#if LV_VERSION_CHECK(8, 0, 0)
+/*Store all the custom data of the font*/
+static  lv_font_fmt_txt_glyph_cache_t cache;
+static const lv_font_fmt_txt_dsc_t font_dsc = {{
+#else
+static lv_font_fmt_txt_dsc_t font_dsc = {{
+#endif
+    .glyph_bitmap = glyph_bitmap,
+    .glyph_dsc = glyph_dsc,
+    .cmaps = cmaps,
+    .kern_dsc = {kern_ref},
+    .kern_scale = {kern_scale},
+    .cmap_num = {cmap_num},
+    .bpp = {bpp},
+    .kern_classes = {kern_classes},
+    .bitmap_format = 0,
+#if LV_VERSION_CHECK(8, 0, 0)
+    .cache = &cache
+#endif
+}};
+
+
+/*-----------------
+ *  PUBLIC FONT
+ *----------------*/
+
+/*Initialize a public general font descriptor*/
+#if LV_VERSION_CHECK(8, 0, 0)
+const lv_font_t {name} = {{
+#else
+lv_font_t {name} = {{
+#endif
+    .get_glyph_dsc = lv_font_get_glyph_dsc_fmt_txt,    /*Function pointer to get glyph's data*/
+    .get_glyph_bitmap = lv_font_get_bitmap_fmt_txt,    /*Function pointer to get glyph's bitmap*/
+    .line_height = {line_height},          /*The maximum line height required by the font*/
+    .base_line = {base_line},             /*Baseline measured from the bottom of the line*/
+#if !(LVGL_VERSION_MAJOR == 6 && LVGL_VERSION_MINOR == 0)
+    .subpx = LV_FONT_SUBPX_NONE,
+#endif
+#if LV_VERSION_CHECK(7, 4, 0) || LVGL_VERSION_MAJOR >= 8
+    .underline_position = {underline_position},
+    .underline_thickness = {underline_thickness},
+#endif
+    .dsc = &font_dsc           /*The custom font data. Will be accessed by `get_glyph_bitmap/dsc` */
+}};
+
+
+
+#endif /*#if {guard}*/
+
+""".format(size=font["size"], bpp=bpp, opts=opts, guard=font["guard"], bitmap=",\n\n".join(bitmap_lines),
+           glyphs=",\n".join(glyph_lines), cmaps=",\n".join(cmaps), kern=kern_src, kern_ref=kern_ref,
+           kern_scale=font["kern_scale"], cmap_num=len(cmaps), kern_classes=kern_classes, name=font["name"],
+           line_height=font["line_height"], base_line=font["base_line"],
+           underline_position=font["underline_position"], underline_thickness=font["underline_thickness"])
+    open(path, "w", encoding="utf-8", newline="\n").write(out)
+    return len(bitmap)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("font", help="lv_font_conv generated C file")
+    parser.add_argument("-o", "--output", help="output file, default overwrite the input")
+    parser.add_argument("--chars", required=True, help="characters to keep")
+    parser.add_argument("--bpp", type=int, choices=(1, 2, 4, 8), help="output bpp, default keep")
+    parser.add_argument("--no-kerning", action="store_true", help="drop kerning data")
+    args = parser.parse_args()
+
+    font = parse(args.font)
+    bpp = args.bpp or font["bpp"]
+    opts = "tools/font_subset.py --chars \"%s\" --bpp %d%s" % (args.chars, bpp, " --no-kerning" if args.no_kerning else "")
+    size = write(font, args.output or args.font, args.chars, bpp, not args.no_kerning, opts)
+    print("%s: %d glyphs, %d bpp, %d bitmap bytes" % (font["name"], len(set(args.chars)), bpp, size))
+
+
+if __name__ == "__main__":
+    main()